@@ -147,6 +147,44 @@ TEST_F(GidFilterTest, complex_disjunctive_location_expressions_are_not_filtered)
                             "id::testdoctype1:n=12345678:bar"));
 }
 
+TEST_F(GidFilterTest, disjunctions_of_location_expressions_are_filtered)
+{
+    const char* selection = "id.user == 12345 or (id.user == 23456 and true) or id.group == 'bjarne'";
+    EXPECT_TRUE(might_match(selection, "id::testdoctype1:n=12345:bar"));
+    EXPECT_TRUE(might_match(selection, "id::testdoctype1:n=23456:bar"));
+    EXPECT_TRUE(might_match(selection, "id::testdoctype1:g=bjarne:bar"));
+    EXPECT_TRUE(!might_match(selection, "id::testdoctype1:n=34567:bar"));
+    EXPECT_TRUE(!might_match(selection, "id::testdoctype1:g=andrei:bar"));
+    EXPECT_TRUE(!might_match("(id.user == 1 or id.user == 2) and (id.user == 2 or id.user == 3)",
+                             "id::testdoctype1:n=1:bar"));
+    EXPECT_TRUE(might_match("(id.user == 1 or id.user == 2) and (id.user == 2 or id.user == 3)",
+                            "id::testdoctype1:n=2:bar"));
+}
+
+TEST_F(GidFilterTest, conjunction_of_differing_locations_matches_nothing)
+{
+    EXPECT_TRUE(!might_match("id.user == 12345 and id.user == 23456",
+                             "id::testdoctype1:n=12345:bar"));
+    EXPECT_TRUE(!might_match("id.user == 12345 and id.user == 23456",
+                             "id::testdoctype1:n=23456:bar"));
+}
+
+TEST_F(GidFilterTest, non_equality_location_comparisons_are_not_filtered)
+{
+    EXPECT_TRUE(might_match("id.user != 12345", "id::testdoctype1:n=23456:bar"));
+    EXPECT_TRUE(might_match("id.user > 12345", "id::testdoctype1:n=23456:bar"));
+    EXPECT_TRUE(might_match("id.group = 'bjar*'", "id::testdoctype1:g=bjarne:bar"));
+    EXPECT_TRUE(might_match("not id.user == 12345", "id::testdoctype1:n=23456:bar"));
+}
+
+TEST_F(GidFilterTest, glob_location_comparisons_without_wildcards_are_filtered)
+{
+    EXPECT_TRUE(might_match("id.user = 12345", "id::testdoctype1:n=12345:bar"));
+    EXPECT_TRUE(!might_match("id.user = 12345", "id::testdoctype1:n=23456:bar"));
+    EXPECT_TRUE(might_match("id.group = 'bjarne'", "id::testdoctype1:g=bjarne:bar"));
+    EXPECT_TRUE(!might_match("id.group = 'bjarne'", "id::testdoctype1:g=andrei:bar"));
+}
+
 TEST_F(GidFilterTest, non_location_id_comparisons_are_not_filtered)
 {
     // Note: these selections are syntactically valid but semantically
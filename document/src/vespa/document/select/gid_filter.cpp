@@ -5,7 +5,9 @@
 #include "valuenodes.h"
 #include "compare.h"
 #include "branch.h"
+#include "operator.h"
 #include <vespa/document/base/idstring.h>
+#include <iterator>
 
 namespace document::select {
 
@@ -70,87 +72,140 @@ struct IdComparisonVisitor : NoOpVisitor {
     }
 };
 
+/**
+ * Set of GID locations that documents matching a sub-expression may have.
+ * An unconstrained set allows any location.
+ */
+struct LocationSet {
+    std::vector<uint32_t> locations; // Sorted and unique
+    bool constrained;
+
+    static LocationSet any() { return {{}, false}; }
+    static LocationSet single(uint32_t location) { return {{location}, true}; }
+};
+
+LocationSet intersection_of(LocationSet lhs, LocationSet rhs) {
+    if (!lhs.constrained) {
+        return rhs;
+    }
+    if (!rhs.constrained) {
+        return lhs;
+    }
+    LocationSet result{{}, true};
+    std::set_intersection(lhs.locations.begin(), lhs.locations.end(),
+                          rhs.locations.begin(), rhs.locations.end(),
+                          std::back_inserter(result.locations));
+    return result;
+}
+
+LocationSet union_of(LocationSet lhs, LocationSet rhs) {
+    if (!lhs.constrained || !rhs.constrained) {
+        return LocationSet::any();
+    }
+    LocationSet result{{}, true};
+    std::set_union(lhs.locations.begin(), lhs.locations.end(),
+                   rhs.locations.begin(), rhs.locations.end(),
+                   std::back_inserter(result.locations));
+    return result;
+}
+
+bool is_location_equality_operator(const Operator& op, const IdComparisonVisitor& id_visitor) {
+    if (op == FunctionOperator::EQ) {
+        return true;
+    }
+    // Globbing falls back to equality for non-string operands, and a glob
+    // without wildcards only matches the string itself.
+    if (op == GlobOperator::GLOB) {
+        return (id_visitor._int_literal_node
+                || (id_visitor._string_literal_node->getValue().find_first_of("*?") == std::string::npos));
+    }
+    return false;
+}
+
 /**
  * Base visitor type invariant: it MUST NOT descend further down the tree by
  * default for any inner node.
  */
 class LocationConstraintVisitor : public NoOpVisitor {
-    GidFilter::OptionalLocation _location;
+    LocationSet _locations;
 public:
-    GidFilter::OptionalLocation location() const noexcept { return _location; }
+    LocationConstraintVisitor() : _locations(LocationSet::any()) {}
+    LocationSet locations() && noexcept { return std::move(_locations); }
+
+    static LocationSet locations_of(const Node& node) {
+        LocationConstraintVisitor visitor;
+        node.visit(visitor);
+        return std::move(visitor).locations();
+    }
 private:
     void visitAndBranch(const And& node) override {
-        node.getLeft().visit(*this);
-        node.getRight().visit(*this);
+        _locations = intersection_of(locations_of(node.getLeft()), locations_of(node.getRight()));
     }
 
     /**
-     * We explicitly DO NOT visit OR/NOT branches here. This implicitly
-     * causes the DFS of the AST to terminate early and does not attempt to
-     * identify any location predicates further down the tree. This means that
-     * we only process location predicates that are _directly_ reachable from
-     * the root node via 0-n AND branches and therefore must be matched in
-     * order for the whole selection to match. The default behavior when
-     * we cannot find a location predicate is to assume all documents may match,
-     * which is the correct behavior in any other case, as we can no longer
-     * guarantee that not matching the GID will cause the selection itself to
-     * also mismatch.
+     * An OR branch only constrains the location if both of its children do.
+     * We explicitly DO NOT visit NOT branches here. This implicitly causes
+     * the DFS of the AST to terminate early and does not attempt to identify
+     * any location predicates further down the tree. This means that we only
+     * process location predicates that must be matched in order for the whole
+     * selection to match. The default behavior when we cannot find a location
+     * predicate is to assume all documents may match, which is the correct
+     * behavior in any other case, as we can no longer guarantee that not
+     * matching the GID will cause the selection itself to also mismatch.
      */
+    void visitOrBranch(const Or& node) override {
+        _locations = union_of(locations_of(node.getLeft()), locations_of(node.getRight()));
+    }
 
     void visitComparison(const Compare& cmp) override {
         IdComparisonVisitor id_visitor;
         cmp.getLeft().visit(id_visitor);
         cmp.getRight().visit(id_visitor);
-        if (!id_visitor.is_valid_location_sub_expression()) {
+        if (!id_visitor.is_valid_location_sub_expression()
+            || !is_location_equality_operator(cmp.getOperator(), id_visitor))
+        {
             return; // Don't bother visiting any subtrees.
         }
-        extract_location_from_id_visitor(id_visitor);
+        _locations = LocationSet::single(location_from_id_visitor(id_visitor));
     }
 
-    uint32_t truncate_location(int64_t full_location) const noexcept {
+    static uint32_t truncate_location(int64_t full_location) noexcept {
         return static_cast<uint32_t>(full_location);
     }
 
-    uint32_t location_from_integer_literal_node(
-            const IntegerValueNode& node) const
-    {
+    static uint32_t location_from_integer_literal_node(const IntegerValueNode& node) {
         Context ctx;
         auto rhs = node.getValue(ctx);
         auto full_location = static_cast<const IntegerValue&>(*rhs).getValue();
         return truncate_location(full_location);
     }
 
-    uint32_t location_from_string_literal_node(
-            const StringValueNode& node) const
-    {
+    static uint32_t location_from_string_literal_node(const StringValueNode& node) {
         auto full_location = IdString::makeLocation(node.getValue());
         return truncate_location(full_location);
     }
 
-    void extract_location_from_id_visitor(const IdComparisonVisitor& visitor) {
-        uint32_t location;
+    static uint32_t location_from_id_visitor(const IdComparisonVisitor& visitor) {
         if (visitor._int_literal_node) {
-            location = location_from_integer_literal_node(
-                    *visitor._int_literal_node);
-        } else {
-            location = location_from_string_literal_node(
-                    *visitor._string_literal_node);
+            return location_from_integer_literal_node(*visitor._int_literal_node);
         }
-        _location = GidFilter::OptionalLocation(location);
+        return location_from_string_literal_node(*visitor._string_literal_node);
     }
 };
 
-GidFilter::OptionalLocation location_bits_from_selection(const Node& ast_root) {
-    LocationConstraintVisitor visitor;
-    ast_root.visit(visitor);
-    return visitor.location();
-}
-
 } // anon ns
 
 GidFilter::GidFilter(const Node& ast_root)
-    : _required_gid_location(location_bits_from_selection(ast_root))
+    : _locations(),
+      _constrained(false)
 {
+    auto locations = LocationConstraintVisitor::locations_of(ast_root);
+    _locations = std::move(locations.locations);
+    _constrained = locations.constrained;
 }
 
+GidFilter::GidFilter(const GidFilter&) = default;
+GidFilter& GidFilter::operator=(const GidFilter&) = default;
+GidFilter::~GidFilter() = default;
+
 }
@@ -2,6 +2,8 @@
 #pragma once
 
 #include <vespa/document/base/globalid.h>
+#include <algorithm>
+#include <vector>
 
 namespace document::select {
 
@@ -15,25 +17,11 @@ class Node;
  * potentially slow storage in order to evaluate the selection in full.
  */
 class GidFilter {
-public:
-    // GCC <= 5.3 has a bug where copying a boost::optional at certain -O
-    // levels causes a erroneous compiler warning.
-    // Using our own poor-man's optional for now.
-    // TODO: replace with std::otional once on a C++17 stdlib.
-    struct OptionalLocation {
-        uint32_t _location;
-        bool _valid;
-
-        OptionalLocation() : _location(0), _valid(false) {}
-
-        explicit OptionalLocation(uint32_t location)
-            : _location(location),
-              _valid(true)
-        {
-        }
-    };
-private:
-    OptionalLocation _required_gid_location;
+    // Sorted, unique set of GID locations a matching document may have.
+    // Only used if _constrained is set; an empty set then means that no
+    // document may match.
+    std::vector<uint32_t> _locations;
+    bool                  _constrained;
 
     /**
      * Lifetime of AST Node pointed to does not have to extend beyond the call
@@ -44,21 +32,27 @@ public:
     /**
      * No-op filter; everything matches always.
      */
-    GidFilter()
-        : _required_gid_location()
+    GidFilter() noexcept
+        : _locations(),
+          _constrained(false)
     {
     }
 
     /**
-     * A GidFilter instance may be safely and cheaply copied. No dependencies
+     * A GidFilter instance may be safely copied. No dependencies
      * exist on the life time of the AST from which it was created.
      */
-    GidFilter(const GidFilter&) = default;
-    GidFilter& operator=(const GidFilter&) = default;
+    GidFilter(const GidFilter&);
+    GidFilter& operator=(const GidFilter&);
+    GidFilter(GidFilter&&) noexcept = default;
+    GidFilter& operator=(GidFilter&&) noexcept = default;
+    ~GidFilter();
 
     /**
-     * Create a filter with a location inferred from the provided selection.
-     * If the selection does not contain a location predicate, the GidFilter
+     * Create a filter with the set of locations inferred from the provided
+     * selection. Location predicates are combined through AND (intersection)
+     * and OR (union, only if both sides are location constrained) branches.
+     * If the selection does not constrain the location, the GidFilter
      * will effectively act as a no-op which assumes every document may match.
      *
      * It is safe to use the resulting GidFilter even if the lifetime of the
@@ -72,17 +66,22 @@ public:
     /**
      * Returns false iff there exists no way that a document whose ID has the
      * given GID can possibly match the selection. This currently only applies
-     * if the document selection contains a location-based predicate (i.e.
-     * id.user or id.group).
+     * if the document selection contains location-based equality predicates
+     * (i.e. id.user or id.group).
      *
      * As the name implies this is a probabilistic match; it's possible for
      * this function to return true even if the document selection matched
      * against the full document/documentid would return false.
      */
-    bool gid_might_match_selection(const GlobalId& gid) const {
+    bool gid_might_match_selection(const GlobalId& gid) const noexcept {
+        if (!_constrained) {
+            return true;
+        }
         const uint32_t gid_location = gid.getLocationSpecificBits();
-        return (!_required_gid_location._valid
-                || (gid_location == _required_gid_location._location));
+        if (_locations.size() <= 8) {
+            return std::find(_locations.begin(), _locations.end(), gid_location) != _locations.end();
+        }
+        return std::binary_search(_locations.begin(), _locations.end(), gid_location);
     }
 };
 
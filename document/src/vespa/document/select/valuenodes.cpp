@@ -205,7 +205,10 @@ FieldValueNode::FieldValueNode(const std::string& doctype,
                                const std::string& fieldExpression)
     : _doctype(doctype),
       _fieldExpression(fieldExpression),
-      _fieldName(extractFieldName(fieldExpression))
+      _fieldName(extractFieldName(fieldExpression)),
+      _fieldPath(),
+      _resolved_type(nullptr),
+      _resolution(Resolution::WRONG_TYPE)
 {
 }
 
@@ -421,6 +424,22 @@ bool is_simple_imported_field(const std::string& expr, const DocumentType& doc_t
 
 }
 
+FieldValueNode::Resolution
+FieldValueNode::resolve(const DocumentType& type) const
+{
+    if (_resolved_type != &type) {
+        if (!document_type_is_a(type, _doctype)) {
+            _resolution = Resolution::WRONG_TYPE;
+        } else if (is_simple_imported_field(_fieldExpression, type)) {
+            _resolution = Resolution::IMPORTED_FIELD;
+        } else {
+            _resolution = Resolution::FIELD_PATH;
+        }
+        _resolved_type = &type;
+    }
+    return _resolution;
+}
+
 std::unique_ptr<Value>
 FieldValueNode::getValue(const Context& context) const
 {
@@ -429,8 +448,9 @@ FieldValueNode::getValue(const Context& context) const
     }
 
     const Document& doc = *context._doc;
+    const Resolution resolution = resolve(doc.getType());
 
-    if (!document_type_is_a(doc.getType(), _doctype)) {
+    if (resolution == Resolution::WRONG_TYPE) {
         return std::make_unique<InvalidValue>();
     }
     // Imported fields can only be meaningfully evaluated inside Proton, so we
@@ -440,7 +460,7 @@ FieldValueNode::getValue(const Context& context) const
     // augment the FieldPath code with knowledge of imported fields.
     // When a selection is running inside Proton, it will patch FieldValueNodes for
     // imported fields, which removes this check entirely.
-    if (is_simple_imported_field(_fieldExpression, doc.getType())) {
+    if (resolution == Resolution::IMPORTED_FIELD) {
         return std::make_unique<NullValue>();
     }
     try {
@@ -169,10 +169,17 @@ public:
 
 class FieldValueNode : public ValueNode
 {
+    // How the field expression resolves against a given document type.
+    enum class Resolution : uint8_t { WRONG_TYPE, IMPORTED_FIELD, FIELD_PATH };
+
     std::string _doctype;
     std::string _fieldExpression;
     std::string _fieldName;
     mutable FieldPath _fieldPath;
+    // Resolution is cached for the document type last evaluated against,
+    // as all documents visited in a bucket usually share the same type.
+    mutable const DocumentType* _resolved_type;
+    mutable Resolution _resolution;
 
 public:
     FieldValueNode(const std::string& doctype, const std::string& fieldExpression);
@@ -200,6 +207,7 @@ public:
 private:
 
     void initFieldPath(const DocumentType&) const;
+    Resolution resolve(const DocumentType&) const;
 };
 
 class FunctionValueNode;
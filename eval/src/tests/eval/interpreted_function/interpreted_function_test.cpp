@@ -7,6 +7,9 @@
 #include <vespa/eval/eval/interpreted_function.h>
 #include <vespa/eval/eval/compile_tensor_function.h>
 #include <vespa/eval/eval/test/eval_spec.h>
+#include <vespa/eval/eval/test/gen_spec.h>
+#include <vespa/eval/eval/test/reference_evaluation.h>
+#include <vespa/eval/eval/value_codec.h>
 #include <vespa/eval/eval/basic_nodes.h>
 #include <vespa/eval/eval/simple_value.h>
 #include <vespa/vespalib/gtest/gtest.h>
@@ -15,6 +18,8 @@
 #include <iostream>
 
 using namespace vespalib::eval;
+using vespalib::eval::test::GenSpec;
+using vespalib::eval::test::ReferenceEvaluation;
 using vespalib::Stash;
 
 //-----------------------------------------------------------------------------
@@ -155,6 +160,25 @@ TEST(InterpretedFunctionTest, require_that_basic_addition_works)
     EXPECT_EQ(interpreted.eval(ctx, params_40).as_double(), 50.0);
 }
 
+TEST(InterpretedFunctionTest, require_that_repeated_evaluation_with_large_intermediate_results_works)
+{
+    // intermediate results are too large for the default stash chunk
+    auto function = Function::parse("reduce((a*b)+(a-b),sum,y)");
+    auto type = ValueType::from_spec("tensor(x[64],y[256])");
+    auto node_types = NodeTypes(*function, {type, type});
+    InterpretedFunction interpreted(FastValueBuilderFactory::get(), *function, node_types);
+    InterpretedFunction::Context ctx(interpreted);
+    for (double bias: {1.0, 2.0, 3.0, 2.0, 1.0}) {
+        auto a_spec = GenSpec(bias).idx("x", 64).idx("y", 256).gen();
+        auto b_spec = GenSpec(bias * 2).idx("x", 64).idx("y", 256).gen();
+        auto a_value = value_from_spec(a_spec, FastValueBuilderFactory::get());
+        auto b_value = value_from_spec(b_spec, FastValueBuilderFactory::get());
+        SimpleObjectParams params({*a_value, *b_value});
+        auto expect = ReferenceEvaluation::eval(*function, {a_spec, b_spec});
+        EXPECT_EQ(spec_from_value(interpreted.eval(ctx, params)), expect);
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 TEST(InterpretedFunctionTest, require_that_functions_with_non_compilable_simple_lambdas_cannot_be_interpreted)
@@ -0,0 +1,98 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/eval/eval/tensor_function.h>
+#include <vespa/eval/eval/test/eval_fixture.h>
+#include <vespa/eval/eval/test/gen_spec.h>
+#include <vespa/eval/instruction/dense_join_reduce_function.h>
+#include <vespa/vespalib/gtest/gtest.h>
+
+using namespace vespalib;
+using namespace vespalib::eval;
+using namespace vespalib::eval::test;
+
+struct FunInfo {
+    using LookFor = DenseJoinReduceFunction;
+    Aggr aggr;
+    void verify(const LookFor &fun) const {
+        EXPECT_TRUE(fun.result_is_mutable());
+        EXPECT_EQ(int(fun.aggr()), int(aggr));
+    }
+};
+
+void verify_optimized(const std::string &expr, Aggr aggr = Aggr::SUM) {
+    SCOPED_TRACE(expr);
+    auto same_types = CellTypeSpace(CellTypeUtils::list_types(), 2).same();
+    EvalFixture::verify<FunInfo>(expr, {FunInfo{aggr}}, same_types);
+}
+
+void verify_not_optimized(const std::string &expr) {
+    SCOPED_TRACE(expr);
+    CellTypeSpace just_double({CellType::DOUBLE}, 2);
+    EvalFixture::verify<FunInfo>(expr, {}, just_double);
+}
+
+//-----------------------------------------------------------------------------
+
+TEST(DenseJoinReduceFunctionTest, join_with_partial_reduce_is_optimized) {
+    verify_optimized("reduce(x5y3-x5y3,sum,y)");
+    verify_optimized("reduce(x5y3-x5y3,sum,x)");
+    verify_optimized("reduce(x5y3+y3z4,sum,y)");
+    verify_optimized("reduce(x5y3+y3z4,sum,x,z)");
+    verify_optimized("reduce(x5-y3,sum,x)");
+}
+
+TEST(DenseJoinReduceFunctionTest, join_with_full_reduce_is_optimized) {
+    verify_optimized("reduce(x5y3-x5y3,sum)");
+    verify_optimized("reduce(x5y3+y3z4,sum,x,y,z)");
+    verify_optimized("reduce(x5y3+y3,sum)");
+}
+
+TEST(DenseJoinReduceFunctionTest, all_simple_aggregators_are_supported) {
+    verify_optimized("reduce(x5y3-x5y3,sum,y)", Aggr::SUM);
+    verify_optimized("reduce(x5y3-x5y3,max,y)", Aggr::MAX);
+    verify_optimized("reduce(x5y3-x5y3,min,y)", Aggr::MIN);
+    verify_optimized("reduce(x5y3-x5y3,prod,y)", Aggr::PROD);
+}
+
+TEST(DenseJoinReduceFunctionTest, any_join_function_can_be_used) {
+    verify_optimized("reduce(x5y3/y3,sum,y)");
+    verify_optimized("reduce(x5y3^y3,sum,y)");
+    verify_optimized("reduce(join(x5y3,y3,f(a,b)(max(a,b))),sum,y)");
+    verify_optimized("reduce(join(x5y3,y3,f(a,b)(a*a-b)),max,y)");
+}
+
+TEST(DenseJoinReduceFunctionTest, trivial_dimensions_are_handled) {
+    verify_optimized("reduce(x5y1z3-x5z3,sum,z)");
+    verify_optimized("reduce(x5y1z3-x5z3,sum,y)");
+}
+
+TEST(DenseJoinReduceFunctionTest, complex_aggregators_are_not_optimized) {
+    verify_not_optimized("reduce(x5y3-x5y3,avg,y)");
+    verify_not_optimized("reduce(x5y3-x5y3,count,y)");
+    verify_not_optimized("reduce(x5y3-x5y3,median,y)");
+}
+
+TEST(DenseJoinReduceFunctionTest, sparse_and_mixed_inputs_are_not_optimized) {
+    verify_not_optimized("reduce(x5_1y3-y3,sum,y)");
+    verify_not_optimized("reduce(x5y3_1-y3_1,sum,y)");
+}
+
+TEST(DenseJoinReduceFunctionTest, join_with_number_is_not_optimized) {
+    verify_not_optimized("reduce(x5y3*reduce(y3,sum),sum,y)");
+}
+
+TEST(DenseJoinReduceFunctionTest, different_cell_types_are_not_optimized) {
+    auto diff_types = CellTypeSpace(CellTypeUtils::list_types(), 2).different();
+    EvalFixture::verify<FunInfo>("reduce(x5y3-y3,sum,y)", {}, diff_types);
+}
+
+TEST(DenseJoinReduceFunctionTest, specialized_functions_are_preferred) {
+    // dot product
+    verify_not_optimized("reduce(x5*x5,sum)");
+    // vector/matrix product
+    verify_not_optimized("reduce(y3*x5y3,sum,y)");
+}
+
+//-----------------------------------------------------------------------------
+
+GTEST_MAIN_RUN_ALL_TESTS()
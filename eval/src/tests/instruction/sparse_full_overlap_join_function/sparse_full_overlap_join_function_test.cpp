@@ -23,6 +23,10 @@ EvalFixture::ParamRepo make_params() {
         .add("m1_ab",  GenSpec(3.0).map("a", 8, 1).map("b", 8, 1))
         .add("m2_ab",  GenSpec(17.0).map("a", 4, 2).map("b", 4, 2))
         .add("m3_bc",  GenSpec(11.0).map("b", 4, 2).map("c", 4, 2))
+        .add("l1_a",   GenSpec(3.0).map("a", 100, 1))
+        .add("l2_a",   GenSpec(7.0).map("a", 45, 3))
+        .add("l1_ab",  GenSpec(3.0).map("a", 10, 1).map("b", 20, 1))
+        .add("l2_ab",  GenSpec(17.0).map("a", 5, 2).map("b", 9, 3))
         .add("scalar", GenSpec(1.0))
         .add("dense_a",  GenSpec().idx("a", 5))
         .add("mixed_ab", GenSpec().map("a", 5, 1).idx("b", 5));
@@ -63,6 +67,14 @@ TEST(SparseFullOverlapJoin, multi_dimensional_expression_can_be_optimized)
     assert_optimized("join(m1_ab,m2_ab,f(x,y)(max(x,y)))");
 }
 
+TEST(SparseFullOverlapJoin, expression_with_many_cells_can_be_optimized)
+{
+    assert_optimized("l1_a-l2_a");
+    assert_optimized("l2_a-l1_a");
+    assert_optimized("l1_ab-l2_ab");
+    assert_optimized("l2_ab-l1_ab");
+}
+
 TEST(SparseFullOverlapJoin, trivial_dimensions_are_ignored)
 {
     assert_optimized("v1_a*v2_a_trivial");
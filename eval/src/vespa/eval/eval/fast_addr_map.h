@@ -133,6 +133,44 @@ public:
             ? lookup_singledim(self(addr[0]))
             : lookup(addr, hash_labels(addr));
     }
+    void prefetch(uint32_t hash) const noexcept {
+        _map.prefetch(Entry{Tag::make_invalid(), hash});
+    }
+    // Look up the addresses of all entries in 'other' in this map,
+    // calling f(other_idx, other_hash, idx) for each of them, where
+    // 'idx' is npos() if the address is not found. Lookups are
+    // performed in small batches, prefetching the buckets for all
+    // addresses in a batch before probing any of them, to overlap the
+    // cache misses of independent lookups.
+    template <typename F>
+    void lookup_all(const FastAddrMap &other, F &&f) const {
+        constexpr size_t batch_size = 16;
+        uint32_t batch_idx[batch_size];
+        uint32_t batch_hash[batch_size];
+        size_t n = 0;
+        auto flush = [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                prefetch(batch_hash[i]);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                auto addr = other.get_addr(batch_idx[i]);
+                size_t idx = (addr.size() == 1)
+                    ? lookup_singledim(addr[0])
+                    : lookup(addr, batch_hash[i]);
+                f(batch_idx[i], batch_hash[i], idx);
+            }
+            n = 0;
+        };
+        other.each_map_entry([&](uint32_t other_idx, uint32_t hash)
+                             {
+                                 batch_idx[n] = other_idx;
+                                 batch_hash[n] = hash;
+                                 if (++n == batch_size) {
+                                     flush();
+                                 }
+                             });
+        flush();
+    }
     void add_mapping(uint32_t hash) {
         uint32_t idx = _map.size();
         _map.force_insert(Entry{{idx}, hash});
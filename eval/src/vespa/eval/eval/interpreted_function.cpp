@@ -11,13 +11,28 @@
 #include <vespa/eval/eval/llvm/compile_cache.h>
 #include <vespa/eval/eval/llvm/addr_to_symbol.h>
 #include <vespa/vespalib/util/benchmark_timer.h>
+#include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/util/stringfmt.h>
+#include <algorithm>
 #include <set>
 
 namespace vespalib::eval {
 
 namespace {
 
+// Sizing of the single stash chunk retained between evaluations (see
+// State::init). The default matches Stash().
+constexpr size_t default_stash_size = 4_Ki;
+constexpr size_t max_retained_stash_size = 4_Mi;
+constexpr uint32_t stash_resize_interval = 256;
+
+// chunk size needed to hold 'used' bytes; objects of a quarter
+// chunk or more are allocated outside the chunk
+size_t stash_size_for(size_t used) {
+    size_t wanted = 4 * used;
+    return ((wanted > default_stash_size) && (wanted <= max_retained_stash_size)) ? wanted : default_stash_size;
+}
+
 const Function *get_simple_lambda(const nodes::Node &node) {
     if (auto ptr = nodes::as<nodes::TensorMap>(node)) {
         return &ptr->lambda();
@@ -55,7 +70,9 @@ InterpretedFunction::State::State(const ValueBuilderFactory &factory_in)
       stash(),
       stack(),
       program_offset(0),
-      if_cnt(0)
+      if_cnt(0),
+      stash_high_water(0),
+      evals_since_stash_resize(0)
 {
 }
 
@@ -64,7 +81,32 @@ InterpretedFunction::State::~State() = default;
 void
 InterpretedFunction::State::init(const LazyParams &params_in) {
     params = &params_in;
-    stash.clear();
+    // Values produced by the previous evaluation that did not fit in
+    // a single stash chunk were either spread over multiple chunks or
+    // allocated separately (large dense cells). Replace the stash with
+    // one whose single chunk can hold them all, so that repeated
+    // evaluations re-use the same memory instead of going through
+    // malloc/free for each intermediate result. The retained chunk
+    // shrinks again when recent evaluations need less.
+    size_t in_chunks = stash.count_used();
+    size_t used = stash.count_used_including_large();
+    stash_high_water = std::max(stash_high_water, used);
+    size_t chunk_size = stash.get_chunk_size();
+    size_t wanted = chunk_size;
+    if ((used > in_chunks) || (in_chunks > chunk_size)) {
+        wanted = stash_size_for(used);
+    } else if (++evals_since_stash_resize >= stash_resize_interval) {
+        wanted = stash_size_for(stash_high_water);
+        stash_high_water = 0;
+        evals_since_stash_resize = 0;
+    }
+    if (wanted != chunk_size) {
+        stash = Stash(wanted);
+        stash_high_water = 0;
+        evals_since_stash_resize = 0;
+    } else {
+        stash.clear();
+    }
     stack.clear();
     program_offset = 0;
     if_cnt = 0;
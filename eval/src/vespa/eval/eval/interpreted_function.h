@@ -37,6 +37,8 @@ public:
         std::vector<Value::CREF>   stack;
         uint32_t                   program_offset;
         uint32_t                   if_cnt;
+        size_t                     stash_high_water;
+        uint32_t                   evals_since_stash_resize;
 
         State(const ValueBuilderFactory &factory_in);
         ~State();
@@ -39,6 +39,7 @@
 #include <vespa/eval/instruction/simple_join_count.h>
 #include <vespa/eval/instruction/mapped_lookup.h>
 #include <vespa/eval/instruction/universal_dot_product.h>
+#include <vespa/eval/instruction/dense_join_reduce_function.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".eval.eval.optimize_tensor_function");
@@ -103,6 +104,7 @@ const TensorFunction &optimize_for_factory(const ValueBuilderFactory &, const Te
                           if (options.allow_universal_dot_product) {
                               child.set(UniversalDotProduct::optimize(child.get(), stash, false));
                           }
+                          child.set(DenseJoinReduceFunction::optimize(child.get(), stash));
                       });
     run_optimize_pass(root, [&stash](const Child &child)
                       {
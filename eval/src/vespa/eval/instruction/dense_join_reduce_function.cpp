@@ -0,0 +1,126 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "dense_join_reduce_function.h"
+#include "dense_join_reduce_plan.h"
+#include <vespa/eval/eval/value.h>
+#include <vespa/eval/eval/inline_operation.h>
+#include <vespa/vespalib/util/typify.h>
+#include <algorithm>
+
+namespace vespalib::eval {
+
+using namespace tensor_function;
+using namespace instruction;
+using namespace operation;
+
+using State = InterpretedFunction::State;
+
+namespace {
+
+struct TypifySimpleAggr {
+    template <template<typename> typename TT> using Result = TypifyResultSimpleTemplate<TT>;
+    template <typename F> static decltype(auto) resolve(Aggr aggr, F &&f) {
+        switch (aggr) {
+        case Aggr::PROD: return f(Result<aggr::Prod>());
+        case Aggr::SUM:  return f(Result<aggr::Sum>());
+        case Aggr::MAX:  return f(Result<aggr::Max>());
+        case Aggr::MIN:  return f(Result<aggr::Min>());
+        default: break;
+        }
+        abort();
+    }
+};
+
+struct DenseJoinReduceParam {
+    const ValueType &res_type;
+    DenseJoinReducePlan plan;
+    join_fun_t function;
+    DenseJoinReduceParam(const ValueType &res_type_in, const ValueType &lhs_type, const ValueType &rhs_type,
+                         join_fun_t function_in)
+      : res_type(res_type_in), plan(lhs_type, rhs_type, res_type_in), function(function_in) {}
+};
+
+template <typename CT, typename JCT, typename OCT, typename AGGR, typename Fun, bool scalar>
+void my_dense_join_reduce_op(State &state, uint64_t param_in) {
+    static_assert(std::is_same_v<OCT,typename AGGR::value_type>);
+    const auto &param = unwrap_param<DenseJoinReduceParam>(param_in);
+    Fun fun(param.function);
+    const CT *lhs = state.peek(1).cells().typify<CT>().data();
+    const CT *rhs = state.peek(0).cells().typify<CT>().data();
+    auto dst_cells = state.stash.create_uninitialized_array<OCT>(param.plan.res_size);
+    OCT *dst = dst_cells.data();
+    std::fill(dst_cells.begin(), dst_cells.end(), AGGR::null_value());
+    auto join_and_combine = [&](size_t lhs_idx, size_t rhs_idx, size_t dst_idx) {
+        dst[dst_idx] = AGGR::combine(dst[dst_idx], JCT(fun(lhs[lhs_idx], rhs[rhs_idx])));
+    };
+    param.plan.execute(0, 0, 0, join_and_combine);
+    if constexpr (scalar) {
+        state.pop_pop_push(state.stash.create<DoubleValue>(dst[0]));
+    } else {
+        state.pop_pop_push(state.stash.create<DenseValueView>(param.res_type, TypedCells(dst_cells)));
+    }
+}
+
+struct SelectDenseJoinReduce {
+    template <typename CM, typename AGGR, typename Fun, typename SCALAR>
+    static auto invoke() {
+        constexpr CellMeta jcm = CellMeta::join(CM::value, CM::value);
+        constexpr CellMeta ocm = jcm.reduce(SCALAR::value);
+        using CT = CellValueType<CM::value.cell_type>;
+        using JCT = CellValueType<jcm.cell_type>;
+        using OCT = CellValueType<ocm.cell_type>;
+        using AggrType = typename AGGR::template templ<OCT>;
+        return my_dense_join_reduce_op<CT, JCT, OCT, AggrType, Fun, SCALAR::value>;
+    }
+};
+
+using MyTypify = TypifyValue<TypifyCellMeta,TypifySimpleAggr,TypifyOp2,TypifyBool>;
+
+bool check_types(const ValueType &res, const ValueType &lhs, const ValueType &rhs) {
+    return (lhs.is_dense() && rhs.is_dense() &&
+            (res.is_dense() || res.is_double()) &&
+            (lhs.cell_type() == rhs.cell_type()));
+}
+
+} // namespace vespalib::eval::<unnamed>
+
+DenseJoinReduceFunction::DenseJoinReduceFunction(const ValueType &res_type_in,
+                                                 const TensorFunction &lhs_in,
+                                                 const TensorFunction &rhs_in,
+                                                 join_fun_t function_in,
+                                                 Aggr aggr_in)
+  : Op2(res_type_in, lhs_in, rhs_in),
+    _function(function_in),
+    _aggr(aggr_in)
+{
+}
+
+DenseJoinReduceFunction::~DenseJoinReduceFunction() = default;
+
+InterpretedFunction::Instruction
+DenseJoinReduceFunction::compile_self(const ValueBuilderFactory &, Stash &stash) const
+{
+    auto &param = stash.create<DenseJoinReduceParam>(result_type(), lhs().result_type(), rhs().result_type(), _function);
+    auto op = typify_invoke<4,MyTypify,SelectDenseJoinReduce>(lhs().result_type().cell_meta().not_scalar(),
+                                                               _aggr, _function, result_type().is_double());
+    return InterpretedFunction::Instruction(op, wrap_param<DenseJoinReduceParam>(param));
+}
+
+const TensorFunction &
+DenseJoinReduceFunction::optimize(const TensorFunction &expr, Stash &stash)
+{
+    if (auto reduce = as<Reduce>(expr); reduce && aggr::is_simple(reduce->aggr())) {
+        if (auto join = as<Join>(reduce->child())) {
+            const ValueType &res_type = expr.result_type();
+            const ValueType &lhs_type = join->lhs().result_type();
+            const ValueType &rhs_type = join->rhs().result_type();
+            if (check_types(res_type, lhs_type, rhs_type)) {
+                return stash.create<DenseJoinReduceFunction>(res_type, join->lhs(), join->rhs(),
+                                                             join->function(), reduce->aggr());
+            }
+        }
+    }
+    return expr;
+}
+
+} // namespace vespalib::eval
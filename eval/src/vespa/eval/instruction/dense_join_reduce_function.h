@@ -0,0 +1,37 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/eval/eval/tensor_function.h>
+#include <vespa/eval/eval/aggr.h>
+
+namespace vespalib::eval {
+
+/**
+ * Tensor function combining a join of two dense tensors with a
+ * reduce of the join result into a single nested loop. Join results
+ * are aggregated directly into the result cells, avoiding the
+ * (potentially large) intermediate tensor produced by a separate
+ * join. This is a general fallback for join/reduce combinations not
+ * handled by more specialized tensor functions (like dot products
+ * and matrix multiplication); it is only used for simple aggregators
+ * and when both inputs have the same cell type.
+ **/
+class DenseJoinReduceFunction : public tensor_function::Op2
+{
+private:
+    tensor_function::join_fun_t _function;
+    Aggr _aggr;
+
+public:
+    DenseJoinReduceFunction(const ValueType &res_type_in, const TensorFunction &lhs_in, const TensorFunction &rhs_in,
+                            tensor_function::join_fun_t function_in, Aggr aggr_in);
+    ~DenseJoinReduceFunction() override;
+    tensor_function::join_fun_t function() const { return _function; }
+    Aggr aggr() const { return _aggr; }
+    bool result_is_mutable() const override { return true; }
+    InterpretedFunction::Instruction compile_self(const ValueBuilderFactory &factory, Stash &stash) const override;
+    static const TensorFunction &optimize(const TensorFunction &expr, Stash &stash);
+};
+
+} // namespace vespalib::eval
@@ -20,27 +20,18 @@ const Value &my_fast_sparse_full_overlap_join(const FastAddrMap &lhs_map, const
 {
     Fun fun(param.function);
     auto &result = stash.create<FastValue<CT,true>>(param.res_type, lhs_map.addr_size(), 1, lhs_map.size());
-    if constexpr (single_dim) {
-        const auto &labels = lhs_map.labels();
-        for (size_t i = 0; i < labels.size(); ++i) {
-            auto rhs_subspace = rhs_map.lookup_singledim(labels[i]);
-            if (rhs_subspace != FastAddrMap::npos()) {
-                result.add_singledim_mapping(labels[i]);
-                auto cell_value = fun(lhs_cells[i], rhs_cells[rhs_subspace]);
-                result.my_cells.push_back_fast(cell_value);
-            }
-        }
-    } else {
-        lhs_map.each_map_entry([&](auto lhs_subspace, auto hash) {
+    rhs_map.lookup_all(lhs_map, [&](auto lhs_subspace, auto hash, auto rhs_subspace) {
+                if (rhs_subspace != FastAddrMap::npos()) {
                     auto lhs_addr = lhs_map.get_addr(lhs_subspace);
-                    auto rhs_subspace = rhs_map.lookup(lhs_addr, hash);
-                    if (rhs_subspace != FastAddrMap::npos()) {
+                    if constexpr (single_dim) {
+                        result.add_singledim_mapping(lhs_addr[0]);
+                    } else {
                         result.add_mapping(lhs_addr, hash);
-                        auto cell_value = fun(lhs_cells[lhs_subspace], rhs_cells[rhs_subspace]);
-                        result.my_cells.push_back_fast(cell_value);
                     }
-                });
-    }
+                    auto cell_value = fun(lhs_cells[lhs_subspace], rhs_cells[rhs_subspace]);
+                    result.my_cells.push_back_fast(cell_value);
+                }
+            });
     return result;
 }
 
@@ -31,37 +31,23 @@ const Value& my_fast_sparse_merge(const FastAddrMap &a_map, const FastAddrMap &b
             result.add_mapping(addr, cur_label.hash());
             result.my_cells.push_back_fast(a_cells[i]);
         }
-        const auto &b_labels = b_map.labels();
-        for (size_t i = 0; i < b_labels.size(); ++i) {
-            cur_label = b_labels[i];
-            auto result_subspace = result.my_index.map.lookup_singledim(cur_label);
-            if (result_subspace == FastAddrMap::npos()) {
-                result.add_mapping(addr, cur_label.hash());
-                result.my_cells.push_back_fast(b_cells[i]);
-            } else {
-                CT *out_cell = result.my_cells.get(result_subspace);
-                out_cell[0] = fun(out_cell[0], b_cells[i]);
-            }
-        }
     } else {
         a_map.each_map_entry([&](auto lhs_subspace, auto hash)
         {
             result.add_mapping(a_map.get_addr(lhs_subspace), hash);
             result.my_cells.push_back_fast(a_cells[lhs_subspace]);
         });
-        b_map.each_map_entry([&](auto rhs_subspace, auto hash)
-        {
-            auto rhs_addr = b_map.get_addr(rhs_subspace);
-            auto result_subspace = result.my_index.map.lookup(rhs_addr, hash);
-            if (result_subspace == FastAddrMap::npos()) {
-                result.add_mapping(rhs_addr, hash);
-                result.my_cells.push_back_fast(b_cells[rhs_subspace]);
-            } else {
-                CT *out_cell = result.my_cells.get(result_subspace);
-                out_cell[0] = fun(out_cell[0], b_cells[rhs_subspace]);
-            }
-        });
     }
+    result.my_index.map.lookup_all(b_map, [&](auto rhs_subspace, auto hash, auto result_subspace)
+    {
+        if (result_subspace == FastAddrMap::npos()) {
+            result.add_mapping(b_map.get_addr(rhs_subspace), hash);
+            result.my_cells.push_back_fast(b_cells[rhs_subspace]);
+        } else {
+            CT *out_cell = result.my_cells.get(result_subspace);
+            out_cell[0] = fun(out_cell[0], b_cells[rhs_subspace]);
+        }
+    });
     return result;
 }
 
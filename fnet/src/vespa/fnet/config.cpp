@@ -1,6 +1,19 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "config.h"
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+// Transports use io_uring for event selection (when supported) if
+// VESPA_FNET_USE_IO_URING is set to 'true'; epoll is the default.
+bool use_io_uring_from_env() {
+    const char *env = getenv("VESPA_FNET_USE_IO_URING");
+    return (env != nullptr) && (std::string(env) == "true");
+}
+
+}
 
 FNET_Config::FNET_Config()
     : _iocTimeOut(vespalib::duration::zero()),
@@ -8,6 +21,7 @@ FNET_Config::FNET_Config()
       _maxInputBufferSize(0x10000),
       _maxOutputBufferSize(0x10000),
       _tcpNoDelay(true),
-      _drop_empty_buffers(false)
+      _drop_empty_buffers(false),
+      _use_io_uring(use_io_uring_from_env())
 {
 }
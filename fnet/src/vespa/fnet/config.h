@@ -17,6 +17,7 @@ public:
     uint32_t  _maxOutputBufferSize;
     bool      _tcpNoDelay;
     bool      _drop_empty_buffers;
+    bool      _use_io_uring;
 
     FNET_Config();
 };
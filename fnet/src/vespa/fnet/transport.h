@@ -84,6 +84,12 @@ public:
         _config._drop_empty_buffers = v;
         return *this;
     }
+    // Use io_uring instead of epoll for event selection when supported
+    // (default taken from the VESPA_FNET_USE_IO_URING environment variable)
+    TransportConfig &use_io_uring(bool v) {
+        _config._use_io_uring = v;
+        return *this;
+    }
 
 private:
     FNET_Config                 _config;
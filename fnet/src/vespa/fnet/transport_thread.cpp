@@ -234,7 +234,7 @@ FNET_TransportThread::FNET_TransportThread(FNET_Transport &owner_in)
       _componentsTail(nullptr),
       _componentCnt(0),
       _deleteList(nullptr),
-      _selector(),
+      _selector(owner_in.getConfig()._use_io_uring ? vespalib::SelectorBackend::IO_URING : vespalib::SelectorBackend::EPOLL),
       _queue(),
       _myQueue(),
       _lock(),
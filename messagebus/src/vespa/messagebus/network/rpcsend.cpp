@@ -47,7 +47,7 @@ public:
         v.AddData(std::move(_payload.payload()), sz);
     }
     void fill(const vespalib::Memory & name, vespalib::slime::Cursor & v) const override {
-        v.setData(name, vespalib::Memory(_payload.data(), _payload.size()));
+        v.setData(name, std::make_unique<network::internal::BlobExternalMemory>(std::move(_payload)));
     }
 private:
     mutable Blob _payload;
@@ -1,8 +1,10 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #pragma once
 
+#include <vespa/messagebus/blob.h>
 #include <vespa/messagebus/trace.h>
 #include <vespa/messagebus/routing/routingnode.h>
+#include <vespa/vespalib/data/slime/external_memory.h>
 
 namespace mbus::network::internal {
 /**
@@ -48,5 +50,16 @@ public:
     const vespalib::Version &getVersion() { return _version; }
 };
 
+/**
+ * Exposes an owned payload blob as external slime memory, allowing the payload
+ * to be handed over to a slime object without copying it.
+ */
+class BlobExternalMemory : public vespalib::slime::ExternalMemory {
+private:
+    mbus::Blob _blob;
+public:
+    explicit BlobExternalMemory(mbus::Blob blob) noexcept : _blob(std::move(blob)) { }
+    vespalib::Memory get() const override { return {_blob.data(), _blob.size()}; }
+};
 
 }
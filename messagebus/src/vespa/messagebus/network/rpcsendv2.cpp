@@ -2,6 +2,7 @@
 
 #include "rpcsendv2.h"
 #include "rpcnetwork.h"
+#include "rpcsend_private.h"
 #include "rpcserviceaddress.h"
 #include <vespa/fnet/frt/reflection.h>
 #include <vespa/fnet/frt/require_capabilities.h>
@@ -103,6 +104,29 @@ private:
 };
 OutputBuf::~OutputBuf() = default;
 
+/**
+ * Encodes the slime object and adds it, compressed according to config, as the
+ * (encoding, uncompressed size, data) triplet. If compression is not applied
+ * the encoded buffer is handed over as is, instead of being copied.
+ */
+void
+addSlime(FRT_Values & values, const Slime & slime, CompressionConfig config)
+{
+    OutputBuf rBuf(8_Ki);
+    BinaryFormat::encode(slime, rBuf);
+    DataBuffer & encoded = rBuf.getBuf();
+    ConstBufferRef toCompress(encoded.getData(), encoded.getDataLen());
+    DataBuffer compressed(0);
+    CompressionConfig::Type type = compress(config, toCompress, compressed, true);
+    // When not compressed, the swapped in buffer references the encoded data.
+    DataBuffer & toSend = compressed.referencesExternalData() ? encoded : compressed;
+    const auto bufferLength = toSend.getDataLen();
+    assert(bufferLength <= INT32_MAX);
+    values.AddInt8(type);
+    values.AddInt32(toCompress.size());
+    values.AddData(std::move(toSend).stealBuffer(), bufferLength);
+}
+
 }
 
 void
@@ -130,17 +154,7 @@ RPCSendV2::encodeRequest(FRT_RPCRequest &req, const Version &version, const Rout
     root.setLong(TRACELEVEL_F, traceLevel);
     filler.fill(BLOB_F, root);
 
-    OutputBuf rBuf(8_Ki);
-    BinaryFormat::encode(slime, rBuf);
-    ConstBufferRef toCompress(rBuf.getBuf().getData(), rBuf.getBuf().getDataLen());
-    DataBuffer buf(vespalib::roundUp2inN(rBuf.getBuf().getDataLen()));
-    CompressionConfig::Type type = compress(_net->getCompressionConfig(), toCompress, buf, false);
-
-    args.AddInt8(type);
-    args.AddInt32(toCompress.size());
-    const auto bufferLength = buf.getDataLen();
-    assert(bufferLength <= INT32_MAX);
-    args.AddData(std::move(buf).stealBuffer(), bufferLength);
+    addSlime(args, slime, _net->getCompressionConfig());
 }
 
 namespace {
@@ -245,7 +259,7 @@ RPCSendV2::createResponse(FRT_Values & ret, const string & version, Reply & repl
     root.setString(VERSION_F, version);
     root.setDouble(RETRYDELAY_F, reply.getRetryDelay());
     root.setString(PROTOCOL_F, reply.getProtocol());
-    root.setData(BLOB_F, vespalib::Memory(payload.data(), payload.size()));
+    root.setData(BLOB_F, std::make_unique<network::internal::BlobExternalMemory>(std::move(payload)));
     if (reply.getTrace().getLevel() > 0) {
         root.setString(TRACE_F, reply.getTrace().encode());
     }
@@ -260,16 +274,7 @@ RPCSendV2::createResponse(FRT_Values & ret, const string & version, Reply & repl
         }
     }
 
-    OutputBuf rBuf(8_Ki);
-    BinaryFormat::encode(slime, rBuf);
-    ConstBufferRef toCompress(rBuf.getBuf().getData(), rBuf.getBuf().getDataLen());
-    DataBuffer buf(vespalib::roundUp2inN(rBuf.getBuf().getDataLen()));
-    CompressionConfig::Type type = compress(_net->getCompressionConfig(), toCompress, buf, false);
-
-    ret.AddInt8(type);
-    ret.AddInt32(toCompress.size());
-    assert(buf.getDataLen() <= INT32_MAX);
-    ret.AddData(std::move(buf));
+    addSlime(ret, slime, _net->getCompressionConfig());
 }
 
 } // namespace mbus
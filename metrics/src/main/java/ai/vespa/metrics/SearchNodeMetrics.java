@@ -239,6 +239,9 @@ public enum SearchNodeMetrics implements VespaMetrics {
     CONTENT_PROTON_DOCUMENTDB_INDEX_INDEXES("content.proton.documentdb.index.indexes", Unit.ITEM, "Number of disk or memory indexes"),
     CONTENT_PROTON_DOCUMENTDB_INDEX_IO_SEARCH_READ_BYTES("content.proton.documentdb.index.io.search.read_bytes", Unit.BYTE, "Bytes read from disk index posting list and bitvector files as part of search for this document type"),
     CONTENT_PROTON_DOCUMENTDB_INDEX_IO_SEARCH_CACHED_READ_BYTES("content.proton.documentdb.index.io.search.cached_read_bytes", Unit.BYTE, "Bytes read from cached disk index posting list and bitvector files as part of search for this document type"),
+    CONTENT_PROTON_DOCUMENTDB_INDEX_FLUSH_BYTES_WRITTEN("content.proton.documentdb.index.flush_bytes_written", Unit.BYTE, "Bytes written by flushing memory indexes to disk since startup for this document type"),
+    CONTENT_PROTON_DOCUMENTDB_INDEX_FUSION_BYTES_WRITTEN("content.proton.documentdb.index.fusion_bytes_written", Unit.BYTE, "Bytes written by fusion of disk indexes since startup for this document type"),
+    CONTENT_PROTON_DOCUMENTDB_INDEX_WRITE_AMPLIFICATION("content.proton.documentdb.index.write_amplification", Unit.FRACTION, "Bytes written by flush and fusion divided by bytes written by flush since startup for this document type"),
     CONTENT_PROTON_DOCUMENTDB_READY_INDEX_MEMORY_USAGE_ALLOCATED_BYTES("content.proton.documentdb.ready.index.memory_usage.allocated_bytes", Unit.BYTE, "The number of allocated bytes for this index field in the memory index for this document type"),
     CONTENT_PROTON_DOCUMENTDB_READY_INDEX_DISK_USAGE("content.proton.documentdb.ready.index.disk_usage", Unit.BYTE, "Disk space usage (in bytes) of this index field in all disk indexes for this document type"),
 
@@ -1,8 +1,11 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include <vespa/vespalib/objects/floatingpointtype.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
 #include <vespa/metrics/countmetric.h>
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 using vespalib::Double;
 
@@ -39,4 +42,75 @@ TEST(CountMetricTest, testLongCountMetric)
     EXPECT_EQ(int64_t(84), o.getLongValue("value"));
 }
 
+namespace {
+
+void inc_from_threads(LongCountMetric& m, uint32_t num_threads, uint32_t incs_per_thread) {
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&m, incs_per_thread]() {
+            for (uint32_t i = 0; i < incs_per_thread; ++i) {
+                m.inc();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+}
+
+TEST(CountMetricTest, sharded_count_metric_sums_updates_from_all_threads)
+{
+    LongCountMetric m("test", {}, "description");
+    m.shardAcrossThreads();
+    m.set(10);
+    inc_from_threads(m, 8, 10000);
+    EXPECT_EQ(uint64_t(80010), m.getValue());
+    m.dec(10);
+    EXPECT_EQ(uint64_t(80000), m.getValue());
+    EXPECT_EQ(int64_t(80000), m.getLongValue("value"));
+    EXPECT_EQ(std::string("test count=80000"), m.toString());
+
+    LongCountMetric copy(m);
+    EXPECT_EQ(uint64_t(80000), copy.getValue());
+    copy.inc(5);
+    EXPECT_EQ(uint64_t(80005), copy.getValue());
+    EXPECT_EQ(uint64_t(80000), m.getValue());
+
+    LongCountMetric assigned("assigned", {}, "description");
+    assigned.shardAcrossThreads();
+    assigned.inc(7);
+    assigned = m;
+    EXPECT_EQ(uint64_t(80000), assigned.getValue());
+    assigned.inc();
+    EXPECT_EQ(uint64_t(80001), assigned.getValue());
+
+    m.reset();
+    EXPECT_EQ(uint64_t(0), m.getValue());
+    EXPECT_FALSE(m.used());
+    inc_from_threads(m, 4, 100);
+    EXPECT_EQ(uint64_t(400), m.getValue());
+}
+
+TEST(CountMetricTest, DISABLED_benchmark_concurrent_count_metric_updates)
+{
+    constexpr uint32_t num_threads = 64;
+    constexpr uint32_t incs_per_thread = 200'000;
+    for (bool sharded : {false, true}) {
+        LongCountMetric m("test", {}, "description");
+        if (sharded) {
+            m.shardAcrossThreads();
+        }
+        vespalib::BenchmarkTimer timer(1.0);
+        while (timer.has_budget()) {
+            timer.before();
+            inc_from_threads(m, num_threads, incs_per_thread);
+            timer.after();
+        }
+        fprintf(stderr, "%s: %u threads doing %u inc() each: %g ms\n", (sharded ? "sharded" : "plain"),
+                num_threads, incs_per_thread, timer.min_time() * 1000.0);
+    }
+}
+
 }
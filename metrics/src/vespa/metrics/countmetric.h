@@ -14,6 +14,7 @@
 #pragma once
 
 #include "countmetricvalues.h"
+#include "shardedcounter.h"
 #include <vespa/metrics/metric.h>
 
 namespace metrics {
@@ -45,6 +46,10 @@ class CountMetric : public AbstractCountMetric
 {
     using Values = CountMetricValues<T>;
     MetricValueSet<Values> _values;
+    ShardedCounter         _shards;
+
+    Values values() const;
+    void fold_shards_of(const CountMetric<T, SumOnAdd>& other);
 
 public:
     CountMetric(const String& name, Tags dimensions, const String& description)
@@ -52,11 +57,21 @@ public:
     {}
     CountMetric(const String& name, Tags dimensions, const String& description, MetricSet* owner);
     CountMetric(const CountMetric<T, SumOnAdd>& other, MetricSet* owner);
+    CountMetric(const CountMetric<T, SumOnAdd>& other);
+    CountMetric& operator=(const CountMetric<T, SumOnAdd>& other);
 
     ~CountMetric() override;
 
     MetricValueClass::UP getValues() const override;
 
+    /**
+     * Let inc() and dec() from different threads update separate cache
+     * lines, summing them only when the value is read. Meant for counters
+     * on hot paths that are shared by many threads, as it adds about a
+     * kilobyte to the metric. Copies, such as snapshots, are not sharded.
+     */
+    void shardAcrossThreads();
+
     void set(T value);
     void inc(T value = 1);
     void dec(T value = 1);
@@ -74,9 +89,12 @@ public:
         return new CountMetric<T, SumOnAdd>(*this, owner);
     }
 
-    T getValue() const { return _values.getValues()._value; }
+    T getValue() const { return values()._value; }
 
-    void reset() override { _values.reset(); }
+    void reset() override {
+        _values.reset();
+        _shards.reset();
+    }
     void print(std::ostream&, bool verbose,
                const std::string& indent, uint64_t secondsPassed) const override;
 
@@ -93,7 +111,7 @@ public:
     bool inUse(const MetricValueClass& v) const  override {
         return static_cast<const Values&>(v).inUse();
     }
-    bool used() const override { return _values.getValues().inUse(); }
+    bool used() const override { return values().inUse(); }
     bool sumOnAdd() const override { return SumOnAdd; }
     void addMemoryUsage(MemoryConsumption&) const override;
     void printDebug(std::ostream&, const std::string& indent) const override;
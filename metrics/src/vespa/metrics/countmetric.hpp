@@ -11,23 +11,78 @@ template <typename T, bool SumOnAdd>
 CountMetric<T, SumOnAdd>::CountMetric(const String& name, Tags dimensions,
                                       const String& desc, MetricSet* owner)
     : AbstractCountMetric(name, std::move(dimensions), desc, owner),
-      _values()
+      _values(),
+      _shards()
 {}
 
 template <typename T, bool SumOnAdd>
 CountMetric<T, SumOnAdd>::CountMetric(const CountMetric<T, SumOnAdd>& other, MetricSet* owner)
     : AbstractCountMetric(other, owner),
-      _values(other._values)
+      _values(other._values),
+      _shards()
 {
+    fold_shards_of(other);
+}
+
+template <typename T, bool SumOnAdd>
+CountMetric<T, SumOnAdd>::CountMetric(const CountMetric<T, SumOnAdd>& other)
+    : AbstractCountMetric(other),
+      _values(other._values),
+      _shards()
+{
+    fold_shards_of(other);
 }
 
 template <typename T, bool SumOnAdd>
 CountMetric<T, SumOnAdd>::~CountMetric() = default;
 
+template <typename T, bool SumOnAdd>
+typename CountMetric<T, SumOnAdd>::Values
+CountMetric<T, SumOnAdd>::values() const {
+    Values current(_values.getValues());
+    if (_shards.enabled()) {
+        current._value += _shards.sum();
+    }
+    return current;
+}
+
+template <typename T, bool SumOnAdd>
+CountMetric<T, SumOnAdd>&
+CountMetric<T, SumOnAdd>::operator=(const CountMetric<T, SumOnAdd>& other)
+{
+    if (this != &other) {
+        AbstractCountMetric::operator=(other);
+        Values values(other.values());
+        while (!_values.setValues(values)) {}
+        _shards.reset();
+    }
+    return *this;
+}
+
+template <typename T, bool SumOnAdd>
+void
+CountMetric<T, SumOnAdd>::fold_shards_of(const CountMetric<T, SumOnAdd>& other)
+{
+    // Copies (e.g. snapshots) are only updated by a single thread, so the
+    // cells of a sharded metric are folded into the plain value.
+    if (other._shards.enabled()) {
+        Values values(other.values());
+        while (!_values.setValues(values)) {}
+    }
+}
+
 template <typename T, bool SumOnAdd>
 MetricValueClass::UP
 CountMetric<T, SumOnAdd>::getValues() const {
-    return std::make_unique<Values>(_values.getValues());
+    return std::make_unique<Values>(values());
+}
+
+template <typename T, bool SumOnAdd>
+void
+CountMetric<T, SumOnAdd>::shardAcrossThreads()
+{
+    static_assert(std::is_same_v<T, uint64_t>, "Only 64-bit unsigned counters can be sharded");
+    _shards.enable();
 }
 
 template <typename T, bool SumOnAdd>
@@ -75,12 +130,19 @@ CountMetric<T, SumOnAdd>::set(T value)
     Values values;
     values._value = value;
     while (!_values.setValues(values)) {}
+    _shards.reset();
 }
 
 template <typename T, bool SumOnAdd>
 void
 CountMetric<T, SumOnAdd>::inc(T value)
 {
+    if (_shards.enabled()) {
+        // Wraps around rather than resetting on overflow, which is
+        // only detectable once the cells are summed.
+        _shards.add(value);
+        return;
+    }
     bool overflow;
     Values values;
     do {
@@ -98,6 +160,10 @@ template <typename T, bool SumOnAdd>
 void
 CountMetric<T, SumOnAdd>::dec(T value)
 {
+    if (_shards.enabled()) {
+        _shards.sub(value);
+        return;
+    }
     bool underflow;
     Values values;
     do {
@@ -116,7 +182,7 @@ void
 CountMetric<T, SumOnAdd>::addToSnapshot(Metric& other, std::vector<Metric::UP> &) const
 {
     CountMetric<T, SumOnAdd>& o(reinterpret_cast<CountMetric<T, SumOnAdd>&>(other));
-    o.inc(_values.getValues()._value);
+    o.inc(values()._value);
 }
 
 template <typename T, bool SumOnAdd>
@@ -125,9 +191,9 @@ CountMetric<T, SumOnAdd>::addToPart(Metric& other) const
 {
     CountMetric<T, SumOnAdd>& o(reinterpret_cast<CountMetric<T, SumOnAdd>&>(other));
     if (SumOnAdd) {
-        o.inc(_values.getValues()._value);
+        o.inc(values()._value);
     } else {
-        o.set((_values.getValues()._value + o._values.getValues()._value) / 2);
+        o.set((values()._value + o.values()._value) / 2);
     }
 }
 
@@ -138,12 +204,12 @@ CountMetric<T, SumOnAdd>::print(std::ostream& out, bool verbose,
                                 uint64_t secondsPassed) const
 {
     (void) indent;
-    Values values(_values.getValues());
-    if (values._value == 0 && !verbose) return;
-    out << this->getName() << (SumOnAdd ? " count=" : " value=") << values._value;
+    Values current(values());
+    if (current._value == 0 && !verbose) return;
+    out << this->getName() << (SumOnAdd ? " count=" : " value=") << current._value;
     if (SumOnAdd) {
         if (secondsPassed != 0) {
-            double avgDiff = values._value / ((double) secondsPassed);
+            double avgDiff = current._value / ((double) secondsPassed);
             out << " average_change_per_second=" << avgDiff;
         }
     }
@@ -155,6 +221,9 @@ CountMetric<T, SumOnAdd>::addMemoryUsage(MemoryConsumption& mc) const
 {
     ++mc._countMetricCount;
     mc._countMetricMeta += sizeof(CountMetric<T, SumOnAdd>) - sizeof(Metric);
+    if (_shards.enabled()) {
+        mc._countMetricMeta += ShardedCounter::num_cells * ShardedCounter::cell_size;
+    }
     Metric::addMemoryUsage(mc);
 }
 
@@ -163,8 +232,7 @@ void
 CountMetric<T, SumOnAdd>::printDebug(std::ostream& out,
                                      const std::string& indent) const
 {
-    Values values(_values.getValues());
-    out << "count=" << values._value << " ";
+    out << "count=" << values()._value << " ";
     Metric::printDebug(out, indent);
 }
 
@@ -0,0 +1,48 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "shardedcounter.h"
+
+namespace metrics {
+
+ShardedCounter::ShardedCounter() noexcept = default;
+
+ShardedCounter::~ShardedCounter() = default;
+
+void
+ShardedCounter::enable()
+{
+    if (!_cells) {
+        _cells = std::make_unique<Cells>();
+    }
+}
+
+uint64_t
+ShardedCounter::sum() const noexcept
+{
+    uint64_t result = 0;
+    if (_cells) {
+        for (const Cell& cell : *_cells) {
+            result += cell.value.load(std::memory_order_relaxed);
+        }
+    }
+    return result;
+}
+
+void
+ShardedCounter::reset() noexcept
+{
+    if (_cells) {
+        for (Cell& cell : *_cells) {
+            cell.value.fetch_sub(cell.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+}
+
+uint32_t
+ShardedCounter::next_thread_cell() noexcept
+{
+    static std::atomic<uint32_t> next_cell(0);
+    return next_cell.fetch_add(1, std::memory_order_relaxed) % num_cells;
+}
+
+} // metrics
@@ -0,0 +1,70 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+/**
+ * \class ShardedCounter
+ * \ingroup metrics
+ *
+ * \brief Counter that can be updated by many threads without sharing cache lines.
+ *
+ * The counter is spread across a fixed number of cache line sized cells, and
+ * each thread always updates the same cell. Updates are plain relaxed atomic
+ * additions, so concurrent updates are never lost, and the cells are only
+ * summed when the value is read (typically when taking a snapshot).
+ *
+ * The cells are not allocated until sharding is enabled, so a disabled
+ * counter costs a single pointer.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace metrics {
+
+class ShardedCounter {
+public:
+    static constexpr uint32_t num_cells = 16;
+    static constexpr size_t cell_size = 64;
+
+    ShardedCounter() noexcept;
+    ShardedCounter(const ShardedCounter& rhs) = delete;
+    ShardedCounter& operator=(const ShardedCounter& rhs) = delete;
+    ~ShardedCounter();
+
+    void enable();
+    [[nodiscard]] bool enabled() const noexcept { return bool(_cells); }
+
+    // Must only be called when enabled.
+    void add(uint64_t value) noexcept {
+        (*_cells)[thread_cell()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+    void sub(uint64_t value) noexcept {
+        (*_cells)[thread_cell()].value.fetch_sub(value, std::memory_order_relaxed);
+    }
+
+    /** Returns the sum of all cells, or 0 if not enabled. */
+    [[nodiscard]] uint64_t sum() const noexcept;
+
+    /**
+     * Brings the counter back to 0 by subtracting the value seen in each
+     * cell, so that updates racing with the reset are kept rather than
+     * overwritten.
+     */
+    void reset() noexcept;
+private:
+    struct alignas(cell_size) Cell {
+        std::atomic<uint64_t> value{0};
+    };
+    using Cells = std::array<Cell, num_cells>;
+
+    static uint32_t next_thread_cell() noexcept;
+    static uint32_t thread_cell() noexcept {
+        thread_local const uint32_t cell = next_thread_cell();
+        return cell;
+    }
+
+    std::unique_ptr<Cells> _cells;
+};
+
+} // metrics
@@ -0,0 +1,115 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+// Unit tests and simulation of fusion policy.
+
+#include <vespa/searchcorespi/index/fusion_policy.h>
+#include <vespa/vespalib/gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+
+using searchcorespi::index::FusionPolicy;
+
+namespace {
+
+struct SimulationResult {
+    double write_amplification;
+    double avg_indexes; // Average number of disk indexes searched by a query
+    uint32_t max_indexes;
+    uint32_t fusions;
+};
+
+/*
+ * Simulates a sequence of equally sized flushes of memory indexes.
+ * Fusion runs as soon as the policy allows it after each flush.
+ */
+SimulationResult
+simulate(const FusionPolicy& policy, uint32_t num_flushes, uint64_t flush_size)
+{
+    uint64_t fused_size = 0;
+    uint64_t unfused_size = 0;
+    uint32_t num_flushed = 0;
+    uint64_t bytes_written = 0;
+    uint64_t sum_indexes = 0;
+    SimulationResult result{0.0, 0.0, 0, 0};
+    for (uint32_t i = 0; i < num_flushes; ++i) {
+        unfused_size += flush_size;
+        bytes_written += flush_size;
+        ++num_flushed;
+        uint32_t num_unfused = num_flushed + ((fused_size != 0) ? 1 : 0);
+        uint32_t num_indexes = num_unfused;
+        result.max_indexes = std::max(result.max_indexes, num_indexes);
+        if (num_unfused > 1 && policy.should_fuse(num_unfused, fused_size, unfused_size)) {
+            fused_size += unfused_size;
+            bytes_written += fused_size;
+            unfused_size = 0;
+            num_flushed = 0;
+            num_indexes = 1;
+            ++result.fusions;
+        }
+        sum_indexes += num_indexes;
+    }
+    result.write_amplification = static_cast<double>(bytes_written) / (static_cast<double>(num_flushes) * flush_size);
+    result.avg_indexes = static_cast<double>(sum_indexes) / num_flushes;
+    return result;
+}
+
+}
+
+TEST(FusionPolicyTest, write_amplification_is_bytes_written_per_flushed_byte)
+{
+    EXPECT_DOUBLE_EQ(1.0, FusionPolicy::write_amplification(0, 100));
+    EXPECT_DOUBLE_EQ(2.0, FusionPolicy::write_amplification(100, 100));
+    EXPECT_DOUBLE_EQ(11.0, FusionPolicy::write_amplification(1000, 100));
+    EXPECT_TRUE(std::isinf(FusionPolicy::write_amplification(1000, 0)));
+}
+
+TEST(FusionPolicyTest, unbounded_write_amplification_always_allows_fusion)
+{
+    FusionPolicy policy(2, 0.0);
+    EXPECT_TRUE(policy.should_fuse(2, 1000000, 1));
+    EXPECT_FALSE(policy.is_urgent(2));
+    EXPECT_TRUE(policy.is_urgent(3));
+}
+
+TEST(FusionPolicyTest, fusion_is_held_back_until_write_amplification_is_low_enough)
+{
+    FusionPolicy policy(10, 5.0);
+    EXPECT_FALSE(policy.should_fuse(2, 1000, 100));
+    EXPECT_FALSE(policy.should_fuse(3, 1000, 200));
+    EXPECT_TRUE(policy.should_fuse(4, 1000, 250));
+    EXPECT_TRUE(policy.should_fuse(2, 0, 100));
+}
+
+TEST(FusionPolicyTest, too_many_flushed_indexes_forces_fusion)
+{
+    FusionPolicy policy(3, 5.0);
+    EXPECT_FALSE(policy.should_fuse(3, 1000, 30));
+    EXPECT_TRUE(policy.should_fuse(4, 1000, 40));
+}
+
+TEST(FusionPolicyTest, bounded_write_amplification_reduces_bytes_written)
+{
+    constexpr uint32_t num_flushes = 1000;
+    auto unbounded = simulate(FusionPolicy(2, 0.0), num_flushes, 1);
+    auto bounded = simulate(FusionPolicy(50, 10.0), num_flushes, 1);
+    EXPECT_LT(bounded.write_amplification, unbounded.write_amplification / 10);
+    EXPECT_LE(bounded.max_indexes, 51u);
+    EXPECT_LE(unbounded.max_indexes, 3u);
+}
+
+TEST(FusionPolicyTest, simulate_write_amplification_and_query_fan_out)
+{
+    constexpr uint32_t num_flushes = 2000;
+    for (uint32_t max_flushed : {2u, 10u, 50u}) {
+        for (double max_write_amplification : {0.0, 2.0, 5.0, 10.0, 20.0}) {
+            FusionPolicy policy(max_flushed, max_write_amplification);
+            auto result = simulate(policy, num_flushes, 1);
+            fprintf(stderr, "maxflushed=%2u maxwriteamplification=%4.1f: write amplification %7.2f, "
+                    "avg indexes %5.2f, max indexes %2u, fusions %4u\n",
+                    max_flushed, max_write_amplification, result.write_amplification,
+                    result.avg_indexes, result.max_indexes, result.fusions);
+            EXPECT_LE(result.max_indexes, max_flushed + 1);
+        }
+    }
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
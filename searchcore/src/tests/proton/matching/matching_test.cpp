@@ -1,5 +1,6 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
+#include <vespa/searchcommon/attribute/config.h>
 #include <vespa/searchcore/proton/bucketdb/bucket_db_owner.h>
 #include <vespa/searchcore/proton/documentmetastore/documentmetastore.h>
 #include <vespa/searchcore/proton/matching/fakesearchcontext.h>
@@ -13,7 +14,9 @@
 #include <vespa/searchlib/aggregation/aggregation.h>
 #include <vespa/searchlib/aggregation/grouping.h>
 #include <vespa/searchlib/aggregation/perdocexpression.h>
+#include <vespa/searchlib/attribute/attributefactory.h>
 #include <vespa/searchlib/attribute/extendableattributes.h>
+#include <vespa/searchlib/attribute/integerbase.h>
 #include <vespa/searchlib/engine/docsumreply.h>
 #include <vespa/searchlib/engine/docsumrequest.h>
 #include <vespa/searchlib/engine/searchreply.h>
@@ -135,6 +138,18 @@ MatchingTestSharedState::attribute_context()
             assert(docid + 1 == NUM_DOCS);
             _attribute_context->add(attr);
         }
+        {
+            search::attribute::Config cfg(search::attribute::BasicType::INT32);
+            cfg.setFastSearch(true);
+            auto attr = search::AttributeFactory::createAttribute("ts", cfg);
+            attr->addDocs(NUM_DOCS);
+            auto &int_attr = dynamic_cast<search::IntegerAttribute &>(*attr);
+            for (uint32_t i = 0; i < NUM_DOCS; ++i) {
+                int_attr.update(i, i); // value = docid
+            }
+            attr->commit();
+            _attribute_context->add(attr);
+        }
     }
     return *_attribute_context;
 }
@@ -426,7 +441,7 @@ struct MyWorld {
         Matcher::SP matcher = createMatcher();
         search::fef::Properties overrides;
         auto mtf = matcher->create_match_tools_factory(req, searchContext, attributeContext, metaStore, overrides,
-                                                       ttb(), nullptr, searchContext.getDocIdLimit(), true);
+                                                       ttb(), nullptr, searchContext.getDocIdLimit(), true, "", 0);
         auto diversity = mtf->createDiversifier(HeapSize::lookup(config));
         EXPECT_EQ(expectDiverse, static_cast<bool>(diversity));
     }
@@ -436,7 +451,7 @@ struct MyWorld {
         SearchRequest::SP request = createSimpleRequest("f1", "spread");
         search::fef::Properties overrides;
         auto mtf = matcher->create_match_tools_factory(*request, searchContext, attributeContext, metaStore, overrides,
-                                                       ttb(), nullptr, searchContext.getDocIdLimit(), true);
+                                                       ttb(), nullptr, searchContext.getDocIdLimit(), true, "", 0);
         MatchTools::UP match_tools = mtf->createMatchTools();
         match_tools->setup_first_phase(nullptr);
         return match_tools->match_data().get_termwise_limit();
@@ -1183,6 +1198,34 @@ TEST_F(MatchingTest, require_that_match_phase_limiting_works)
     }
 }
 
+TEST_F(MatchingTest, require_that_match_phase_limiting_can_use_primary_sort_attribute)
+{
+    for (const char *sort_spec : {"+ts", "-ts", "-ts +a1", "+a1", "+[docid]", ""}) {
+        for (bool from_sort : {false, true}) {
+            SCOPED_TRACE(vespalib::make_string("sort_spec='%s', from_sort=%d", sort_spec, from_sort));
+            MyWorld world(shared_state());
+            world.basicSetup();
+            world.verbose_a1_result("all");
+            world.add_match_phase_limiting_result("ts", 128, false, {15, 16, 17, 18, 19, 20, 21});
+            world.add_match_phase_limiting_result("ts", 128, true, {948, 951, 963, 987, 991, 994, 997});
+            if (from_sort) {
+                world.set_property(indexproperties::matchphase::DegradationFromSort::NAME, "true");
+            }
+            SearchRequest::SP request = MyWorld::createSimpleRequest("a1", "all");
+            request->sortSpec = sort_spec;
+            SearchReply::UP reply = world.performSearch(*request, 1);
+            ASSERT_EQ(10u, reply->hits.size());
+            bool expect_limited = from_sort && (std::string_view(sort_spec).substr(1, 2) == "ts");
+            EXPECT_EQ(expect_limited, reply->coverage.wasDegradedByMatchPhase());
+            if (expect_limited) {
+                EXPECT_LT(reply->totalHitCount, 985u);
+            } else {
+                EXPECT_EQ(985u, reply->totalHitCount);
+            }
+        }
+    }
+}
+
 TEST_F(MatchingTest, require_that_arithmetic_used_for_rank_drop_limit_works)
 {
     double small = -HUGE_VAL;
@@ -130,6 +130,9 @@ public:
     void setMaxFlushed(uint32_t maxFlushed) override {
         _maintainer.setMaxFlushed(maxFlushed);
     }
+    void setMaxWriteAmplification(double maxWriteAmplification) override {
+        _maintainer.setMaxWriteAmplification(maxWriteAmplification);
+    }
     bool has_pending_urgent_flush() const override {
         return _maintainer.has_pending_urgent_flush();
     }
@@ -24,7 +24,7 @@ MemoryIndexWrapper::MemoryIndexWrapper(const search::index::Schema& schema,
                                        searchcorespi::index::IThreadingService& threadingService,
                                        search::SerialNum serialNum)
     : _index(schema, inspector, threadingService.field_writer(),
-             threadingService.field_writer()),
+             threadingService.field_writer(), threadingService.index_sort_threads()),
       _serialNum(serialNum),
       _fileHeaderContext(fileHeaderContext),
       _tuneFileIndexing(tuneFileIndexing)
@@ -77,6 +77,39 @@ extractDiversityParams(const RankSetup &rankSetup, const Properties &rankPropert
              AttributeLimiter::toDiversityCutoffStrategy(DiversityCutoffStrategy::lookup(rankProperties, rankSetup.getDiversityCutoffStrategy())) };
 }
 
+/**
+ * Extracts the attribute name and order of the first sort field, when that
+ * field sorts directly on an attribute (no functions, rank or docid).
+ */
+bool
+extractPrimarySortAttribute(const std::string &sortSpec, std::string &attribute, bool &descending)
+{
+    size_t start = sortSpec.find_first_not_of(' ');
+    if ((start == std::string::npos) || ((sortSpec[start] != '+') && (sortSpec[start] != '-'))) {
+        return false;
+    }
+    size_t end = sortSpec.find(' ', start);
+    std::string name = sortSpec.substr(start + 1, (end == std::string::npos) ? std::string::npos : end - start - 1);
+    if (name.empty() || (name.find_first_of("[()") != std::string::npos)) {
+        return false;
+    }
+    attribute = name;
+    descending = (sortSpec[start] == '-');
+    return true;
+}
+
+/**
+ * The attribute limiter walks the attribute dictionary in value order,
+ * which gives the same order as sorting only for single value numeric
+ * attributes with fast-search.
+ */
+bool
+canLimitOnSortAttribute(const search::attribute::IAttributeVector *attr)
+{
+    return (attr != nullptr) && attr->getIsFastSearch() && !attr->hasMultiValue() &&
+           (attr->isIntegerType() || attr->isFloatingPointType());
+}
+
 } // namespace proton::matching::<unnamed>
 
 void
@@ -185,7 +218,9 @@ MatchToolsFactory(QueryLimiter               & queryLimiter,
                   vespalib::ThreadBundle     & thread_bundle,
                   const search::IDocumentMetaStoreContext::IReadGuard::SP * metaStoreReadGuard,
                   uint32_t                     maxNumHits,
-                  bool                         is_search)
+                  bool                         is_search,
+                  const std::string          & sortSpec,
+                  uint32_t                     wantedSortedHits)
     : _queryLimiter(queryLimiter),
       _create_blueprint_params(extract_create_blueprint_params(rankSetup, rankProperties, metaStore.getNumActiveLids(), searchContext.getDocIdLimit())),
       _query(),
@@ -240,6 +275,20 @@ MatchToolsFactory(QueryLimiter               & queryLimiter,
         _diversityParams = extractDiversityParams(_rankSetup, rankProperties);
         std::string attribute = DegradationAttribute::lookup(rankProperties, _rankSetup.getDegradationAttribute());
         DegradationParams degradationParams = extractDegradationParams(_rankSetup, attribute, rankProperties);
+        if (!degradationParams.enabled() && (wantedSortedHits > 0) &&
+            DegradationFromSort::lookup(rankProperties, _rankSetup.isDegradationFromSort()))
+        {
+            std::string sortAttribute;
+            bool descending = false;
+            if (extractPrimarySortAttribute(sortSpec, sortAttribute, descending) &&
+                canLimitOnSortAttribute(_requestContext.getAttribute(sortAttribute)))
+            {
+                attribute = sortAttribute;
+                degradationParams.attribute = sortAttribute;
+                degradationParams.max_hits = wantedSortedHits;
+                degradationParams.descending = descending;
+            }
+        }
 
         if (degradationParams.enabled()) {
             trace.addEvent(5, "Setup match phase limiter");
@@ -164,7 +164,9 @@ public:
                       vespalib::ThreadBundle &thread_bundle,
                       const search::IDocumentMetaStoreContext::IReadGuard::SP * metaStoreReadGuard,
                       uint32_t maxNumHits,
-                      bool is_search);
+                      bool is_search,
+                      const std::string &sortSpec,
+                      uint32_t wantedSortedHits);
     ~MatchToolsFactory();
     bool valid() const { return _valid; }
     const MaybeMatchPhaseLimiter &match_limiter() const { return *_match_limiter; }
@@ -145,7 +145,8 @@ Matcher::create_match_tools_factory(const search::engine::Request &request, ISea
                                     IAttributeContext &attrContext, const search::IDocumentMetaStore &metaStore,
                                     const Properties &feature_overrides, vespalib::ThreadBundle &thread_bundle,
                                     const IDocumentMetaStoreContext::IReadGuard::SP * metaStoreReadGuard,
-                                    uint32_t maxHits, bool is_search) const
+                                    uint32_t maxHits, bool is_search,
+                                    const std::string &sortSpec, uint32_t wantedSortedHits) const
 {
     const Properties & rankProperties = request.propertiesMap.rankProperties();
     bool softTimeoutEnabled = softtimeout::Enabled::lookup(rankProperties, _rankSetup->getSoftTimeoutEnabled());
@@ -167,7 +168,8 @@ Matcher::create_match_tools_factory(const search::engine::Request &request, ISea
                                                request.trace(), queryTree, request.location,
                                                _viewResolver, metaStore, _indexEnv, *_rankSetup,
                                                rankProperties, feature_overrides, thread_bundle,
-                                               metaStoreReadGuard, maxHits, is_search);
+                                               metaStoreReadGuard, maxHits, is_search,
+                                               sortSpec, wantedSortedHits);
 }
 
 size_t
@@ -282,7 +284,9 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
 
         MatchToolsFactory::UP mtf = create_match_tools_factory(request, searchContext, attrContext, metaStore,
                                                                *feature_overrides, threadBundle, &owned_objects.readGuard,
-                                                               searchContext.getDocIdLimit(), true);
+                                                               searchContext.getDocIdLimit(), true,
+                                                               groupingContext.empty() ? request.sortSpec : std::string(),
+                                                               request.offset + request.maxhits);
         isDoomExplicit = mtf->get_request_context().getDoom().isExplicitSoftDoom();
         traceQuery(6, request.trace(), mtf->query());
         if (!mtf->valid()) {
@@ -427,7 +431,8 @@ Matcher::create_docsum_matcher(const DocsumRequest &req, ISearchContext &search_
     StupidMetaStore meta;
     MatchToolsFactory::UP mtf = create_match_tools_factory(req, search_ctx, attr_ctx, meta,
                                                            req.propertiesMap.featureOverrides(),
-                                                           vespalib::ThreadBundle::trivial(), nullptr, docs.size(), false);
+                                                           vespalib::ThreadBundle::trivial(), nullptr, docs.size(), false,
+                                                           std::string(), 0);
     if (!mtf->valid()) {
         LOG(warning, "could not initialize docsum matching: %s",
             (expectedSessionCached) ? "session has expired" : "invalid query");
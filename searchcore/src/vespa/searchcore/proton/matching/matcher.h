@@ -112,7 +112,8 @@ public:
                                IAttributeContext &attrContext, const search::IDocumentMetaStore &metaStore,
                                const Properties &feature_overrides, vespalib::ThreadBundle &thread_bundle,
                                const IDocumentMetaStoreContext::IReadGuard::SP * metaStoreReadGuard,
-                               uint32_t maxHits, bool is_search) const;
+                               uint32_t maxHits, bool is_search,
+                               const std::string &sortSpec, uint32_t wantedSortedHits) const;
 
     /**
      * Perform a search against this matcher.
@@ -95,6 +95,9 @@ DocumentDBTaggedMetrics::IndexMetrics::IndexMetrics(MetricSet *parent)
       memoryUsage(this),
       docsInMemory("docs_in_memory", {}, "Number of documents in memory index", this),
       indexes("indexes", {}, "Number of disk or memory indexes", this),
+      flush_bytes_written("flush_bytes_written", {}, "Bytes written by flushing memory indexes to disk since startup", this),
+      fusion_bytes_written("fusion_bytes_written", {}, "Bytes written by fusion of disk indexes since startup", this),
+      write_amplification("write_amplification", {}, "Bytes written by flush and fusion divided by bytes written by flush since startup", this),
       disk_io(this)
 {
 }
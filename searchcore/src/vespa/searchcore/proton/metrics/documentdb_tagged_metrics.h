@@ -98,6 +98,9 @@ struct DocumentDBTaggedMetrics : metrics::MetricSet
         MemoryUsageMetrics memoryUsage;
         metrics::LongValueMetric docsInMemory;
         metrics::LongValueMetric indexes;
+        metrics::LongValueMetric flush_bytes_written;
+        metrics::LongValueMetric fusion_bytes_written;
+        metrics::DoubleValueMetric write_amplification;
         DiskIoMetrics disk_io;
 
         IndexMetrics(metrics::MetricSet *parent);
@@ -4,13 +4,15 @@
 namespace proton {
 
 DocumentDBFlushConfig::DocumentDBFlushConfig() noexcept
-    : DocumentDBFlushConfig(2, 20)
+    : DocumentDBFlushConfig(2, 20, 0.0)
 {
 }
 
-DocumentDBFlushConfig::DocumentDBFlushConfig(uint32_t maxFlushed, uint32_t maxFlushedRetired) noexcept
+DocumentDBFlushConfig::DocumentDBFlushConfig(uint32_t maxFlushed, uint32_t maxFlushedRetired,
+                                             double maxWriteAmplification) noexcept
     : _maxFlushed(maxFlushed),
-      _maxFlushedRetired(maxFlushedRetired)
+      _maxFlushedRetired(maxFlushedRetired),
+      _maxWriteAmplification(maxWriteAmplification)
 {
 }
 
@@ -19,7 +21,8 @@ DocumentDBFlushConfig::operator==(const DocumentDBFlushConfig &rhs) const noexce
 {
     return
         _maxFlushed == rhs._maxFlushed &&
-        _maxFlushedRetired == rhs._maxFlushedRetired;
+        _maxFlushedRetired == rhs._maxFlushedRetired &&
+        _maxWriteAmplification == rhs._maxWriteAmplification;
 }
 
 } // namespace proton
@@ -11,13 +11,15 @@ namespace proton {
 class DocumentDBFlushConfig {
     uint32_t _maxFlushed;
     uint32_t _maxFlushedRetired;
+    double   _maxWriteAmplification;
 
 public:
     DocumentDBFlushConfig() noexcept;
-    DocumentDBFlushConfig(uint32_t maxFlushed, uint32_t maxFlushedRetired) noexcept;
+    DocumentDBFlushConfig(uint32_t maxFlushed, uint32_t maxFlushedRetired, double maxWriteAmplification) noexcept;
     bool operator==(const DocumentDBFlushConfig &rhs) const noexcept;
     uint32_t getMaxFlushed() const noexcept { return _maxFlushed; }
     uint32_t getMaxFlushedRetired() const noexcept { return _maxFlushedRetired; }
+    double getMaxWriteAmplification() const noexcept { return _maxWriteAmplification; }
 };
 
 } // namespace proton
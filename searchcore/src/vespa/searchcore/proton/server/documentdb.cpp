@@ -183,7 +183,7 @@ DocumentDB::DocumentDB(const std::string &baseDir,
       // Only one thread per executor, or performDropFeedView() will fail.
       _writeServiceConfig(configSnapshot->get_threading_service_config()),
       _writeService(shared_service.shared(), shared_service.transport(), shared_service.field_writer(),
-                    &shared_service.invokeService(), _writeServiceConfig),
+                    &shared_service.invokeService(), _writeServiceConfig, shared_service.index_sort_threads()),
       _initializeThreads(std::move(initializeThreads)),
       _initConfigSnapshot(),
       _initConfigSerialNum(0u),
@@ -79,6 +79,12 @@ updateIndexMetrics(DocumentDBTaggedMetrics &metrics, const search::IndexStats &s
     updateMemoryUsageMetrics(indexMetrics.memoryUsage, stats.memoryUsage(), totalStats);
     indexMetrics.docsInMemory.set(stats.docsInMemory());
     indexMetrics.indexes.set(stats.disk_indexes() + stats.memory_indexes());
+    indexMetrics.flush_bytes_written.set(stats.flush_bytes_written());
+    indexMetrics.fusion_bytes_written.set(stats.fusion_bytes_written());
+    if (stats.flush_bytes_written() > 0) {
+        indexMetrics.write_amplification.set(static_cast<double>(stats.flush_bytes_written() + stats.fusion_bytes_written()) /
+                                             stats.flush_bytes_written());
+    }
     auto& field_metrics = metrics.ready.index;
     search::FieldIndexIoStats disk_io;
     for (auto& field : stats.get_field_stats()) {
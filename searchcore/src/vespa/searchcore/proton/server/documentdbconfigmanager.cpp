@@ -137,7 +137,8 @@ buildMaintenanceConfig(const BootstrapConfig::SP &bootstrapConfig,
             BlockableMaintenanceJobConfig(
                     proton.maintenancejobs.resourcelimitfactor,
                     proton.maintenancejobs.maxoutstandingmoveops),
-            DocumentDBFlushConfig(proton.index.maxflushed,proton.index.maxflushedretired),
+            DocumentDBFlushConfig(proton.index.maxflushed,proton.index.maxflushedretired,
+                                  proton.index.maxwriteamplification),
             BucketMoveConfig(proton.bucketmove.maxdocstomoveperbucket));
 }
 
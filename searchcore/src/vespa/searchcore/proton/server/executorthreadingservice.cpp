@@ -52,7 +52,8 @@ ExecutorThreadingService::ExecutorThreadingService(vespalib::Executor & sharedEx
                                                    FNET_Transport & transport,
                                                    vespalib::ISequencedTaskExecutor& field_writer,
                                                    vespalib::InvokeService * invokerService,
-                                                   const ThreadingServiceConfig & cfg)
+                                                   const ThreadingServiceConfig & cfg,
+                                                   vespalib::SimpleThreadBundle::Pool* index_sort_threads)
 
     : _sharedExecutor(sharedExecutor),
       _transport(transport),
@@ -63,6 +64,7 @@ ExecutorThreadingService::ExecutorThreadingService(vespalib::Executor & sharedEx
       _masterService(_masterExecutor),
       _indexService(*_indexExecutor),
       _field_writer(field_writer),
+      _index_sort_threads(index_sort_threads),
       _invokeRegistrations()
 {
     if (cfg.optimize() == vespalib::Executor::OptimizeFor::THROUGHPUT && invokerService) {
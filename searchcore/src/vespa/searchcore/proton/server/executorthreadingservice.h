@@ -29,6 +29,7 @@ private:
     SyncableExecutorThreadService                        _masterService;
     ExecutorThreadService                                _indexService;
     vespalib::ISequencedTaskExecutor&                    _field_writer;
+    vespalib::SimpleThreadBundle::Pool*                  _index_sort_threads;
     std::vector<Registration>                            _invokeRegistrations;
 
 public:
@@ -44,7 +45,8 @@ public:
                              FNET_Transport & transport,
                              vespalib::ISequencedTaskExecutor& field_writer,
                              vespalib::InvokeService * invokeService,
-                             const ThreadingServiceConfig& cfg);
+                             const ThreadingServiceConfig& cfg,
+                             vespalib::SimpleThreadBundle::Pool* index_sort_threads = nullptr);
     ~ExecutorThreadingService() override;
 
     void blocking_master_execute(vespalib::Executor::Task::UP task) override;
@@ -73,6 +75,7 @@ public:
     }
 
     vespalib::ISequencedTaskExecutor &field_writer() override;
+    vespalib::SimpleThreadBundle::Pool *index_sort_threads() override { return _index_sort_threads; }
     FNET_Transport &transport() override { return _transport; }
     ExecutorThreadingServiceStats getStats();
 };
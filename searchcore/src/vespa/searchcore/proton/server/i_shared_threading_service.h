@@ -2,6 +2,7 @@
 #pragma once
 
 #include <atomic>
+#include <vespa/vespalib/util/simple_thread_bundle.h>
 #include <vespa/vespalib/util/time.h>
 
 class FNET_Transport;
@@ -39,6 +40,12 @@ public:
      */
     virtual vespalib::ISequencedTaskExecutor& field_writer() = 0;
 
+    /**
+     * Returns the pool of thread bundles used to sort large batches of inverted positions
+     * in memory indexes, or nullptr if positions are sorted by the field writer threads alone.
+     */
+    virtual vespalib::SimpleThreadBundle::Pool* index_sort_threads() = 0;
+
     /**
      * Returns an InvokeService intended for regular wakeup calls.
      */
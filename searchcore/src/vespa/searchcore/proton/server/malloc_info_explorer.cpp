@@ -19,6 +19,7 @@ extern "C" {
 // info dumping for it.
 // Vespamalloc:
 void vespamalloc_dump_info(FILE* out_file) __attribute__((weak));
+int vespamalloc_dump_heap_profile(FILE* out_file) __attribute__((weak));
 // MiMalloc:
 // From https://microsoft.github.io/mimalloc/group__extended.html:
 using mi_output_fun = void(const char* msg, void* aux_arg);
@@ -33,6 +34,8 @@ using namespace std::string_view_literals;
 
 namespace {
 
+constexpr std::string_view HEAP_PROFILE = "heap_profile";
+
 #ifdef __linux__
 
 enum class MallocImpl {
@@ -91,6 +94,28 @@ std::string get_vespamalloc_info_dump() {
 #endif
 }
 
+// Returns an empty string if the heap profile is not available.
+std::string get_vespamalloc_heap_profile() {
+#ifdef _POSIX_C_SOURCE // For open_memstream()
+    if (vespamalloc_dump_heap_profile == nullptr) {
+        return {};
+    }
+    char* buf = nullptr;
+    size_t buf_size = 0;
+    FILE* mem_f = open_memstream(&buf, &buf_size);
+    if (mem_f == nullptr) {
+        return {};
+    }
+    const bool dumped = (vespamalloc_dump_heap_profile(mem_f) != 0);
+    fclose(mem_f); // buf and buf_size are updated on fclose()
+    std::string profile = dumped ? std::string(buf, buf_size) : std::string();
+    free(buf);
+    return profile;
+#else
+    return {};
+#endif
+}
+
 void my_mimalloc_info_callback(const char* msg, void* aux_arg) {
     assert(aux_arg != nullptr);
     auto* out_str = static_cast<std::string*>(aux_arg); // untyped C APIs <3
@@ -148,6 +173,25 @@ void emit_malloc_internal_info_dump(Cursor& parent, std::string_view info_dump)
 
 #endif // __linux__
 
+class HeapProfileExplorer : public vespalib::StateExplorer {
+public:
+    void get_state(const Inserter& inserter, bool full) const override {
+        Cursor& object = inserter.insertObject();
+        if (!full) {
+            return;
+        }
+#ifdef __linux__
+        const auto heap_profile = get_vespamalloc_heap_profile();
+        if (!heap_profile.empty()) {
+            // Sampled live heap in pprof (heap_v2) format.
+            object.setString("heap_profile", heap_profile);
+        }
+#else
+        (void) object;
+#endif // __linux__
+    }
+};
+
 } // anon ns
 
 void MallocInfoExplorer::get_state(const Inserter& inserter, bool full) const {
@@ -171,4 +215,26 @@ void MallocInfoExplorer::get_state(const Inserter& inserter, bool full) const {
 #endif // __linux__
 }
 
+std::vector<std::string>
+MallocInfoExplorer::get_children_names() const {
+#ifdef __linux__
+    if (vespamalloc_dump_heap_profile != nullptr) {
+        return {std::string(HEAP_PROFILE)};
+    }
+#endif
+    return {};
+}
+
+std::unique_ptr<vespalib::StateExplorer>
+MallocInfoExplorer::get_child(std::string_view name) const {
+#ifdef __linux__
+    if ((name == HEAP_PROFILE) && (vespamalloc_dump_heap_profile != nullptr)) {
+        return std::make_unique<HeapProfileExplorer>();
+    }
+#else
+    (void) name;
+#endif
+    return {};
+}
+
 } // proton
@@ -14,11 +14,17 @@ namespace proton {
  *      by the platform).
  *   2. Malloc-implementation specific information for implementations we know about.
  *      Currently only covers vespamalloc and mimalloc.
+ *
+ * Children:
+ *   heap_profile: The sampled heap profile in pprof format, if enabled in vespamalloc.
+ *                 Only emitted when this child is explicitly requested, as it is large.
  */
 class MallocInfoExplorer : public vespalib::StateExplorer {
 public:
     ~MallocInfoExplorer() override = default;
     void get_state(const vespalib::slime::Inserter& inserter, bool full) const override;
+    std::vector<std::string> get_children_names() const override;
+    std::unique_ptr<vespalib::StateExplorer> get_child(std::string_view name) const override;
 };
 
 }
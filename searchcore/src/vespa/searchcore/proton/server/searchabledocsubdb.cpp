@@ -190,6 +190,7 @@ SearchableDocSubDB::propagateFlushConfig()
 {
     uint32_t maxFlushed = is_node_retired_or_maintenance() ? _flushConfig.getMaxFlushedRetired() : _flushConfig.getMaxFlushed();
     _indexMgr->setMaxFlushed(maxFlushed);
+    _indexMgr->setMaxWriteAmplification(_flushConfig.getMaxWriteAmplification());
 }
 
 void
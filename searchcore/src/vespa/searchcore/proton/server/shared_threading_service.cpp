@@ -11,11 +11,19 @@ using vespalib::CpuUsage;
 using vespalib::steady_time;
 
 VESPA_THREAD_STACK_TAG(proton_field_writer_executor)
+VESPA_THREAD_STACK_TAG(proton_index_sort_executor)
 VESPA_THREAD_STACK_TAG(proton_shared_executor)
 VESPA_THREAD_STACK_TAG(proton_warmup_executor)
 
 namespace proton {
 
+namespace {
+
+// Max number of threads sorting the inverted positions of a single field.
+constexpr uint32_t max_index_sort_bundle_size = 8;
+
+}
+
 SharedThreadingService::SharedThreadingService(const SharedThreadingServiceConfig& cfg,
                                                FNET_Transport& transport,
                                                storage::spi::BucketExecutor& bucket_executor)
@@ -23,6 +31,7 @@ SharedThreadingService::SharedThreadingService(const SharedThreadingServiceConfi
       _shared(std::make_shared<vespalib::BlockingThreadStackExecutor>(cfg.shared_threads(),
                                                                       cfg.shared_task_limit(), vespalib::be_nice(proton_shared_executor, cfg.feeding_niceness()))),
       _field_writer(),
+      _index_sort_threads(),
       _invokeService(std::make_unique<vespalib::InvokeServiceImpl>(std::max(vespalib::adjustTimeoutByDetectedHz(1ms),
                                                                             cfg.field_writer_config().reactionTime()))),
       _invokeRegistrations(),
@@ -35,6 +44,13 @@ SharedThreadingService::SharedThreadingService(const SharedThreadingServiceConfi
                                                             fw_cfg.is_task_limit_hard(),
                                                             fw_cfg.optimize(),
                                                             fw_cfg.kindOfwatermark());
+    // Bound the total number of threads sorting positions by the number of field writer threads.
+    uint32_t sort_bundle_size = std::min(max_index_sort_bundle_size, cfg.field_writer_threads());
+    if (sort_bundle_size > 1) {
+        _index_sort_threads = std::make_unique<vespalib::SimpleThreadBundle::Pool>(sort_bundle_size,
+                                                                                    vespalib::be_nice(CpuUsage::wrap(proton_index_sort_executor, CpuUsage::Category::WRITE), cfg.feeding_niceness()),
+                                                                                    cfg.field_writer_threads() / sort_bundle_size);
+    }
     if (fw_cfg.optimize() == vespalib::Executor::OptimizeFor::THROUGHPUT) {
         _invokeRegistrations.push_back(_invokeService->registerInvoke([executor = _field_writer.get()]() {
             executor->wakeup();
@@ -21,6 +21,7 @@ private:
     FNET_Transport                                  & _transport;
     std::shared_ptr<vespalib::SyncableThreadExecutor> _shared;
     std::unique_ptr<vespalib::ISequencedTaskExecutor> _field_writer;
+    std::unique_ptr<vespalib::SimpleThreadBundle::Pool> _index_sort_threads;
     std::unique_ptr<vespalib::InvokeService>          _invokeService;
     std::vector<Registration>                         _invokeRegistrations;
     storage::spi::BucketExecutor&                     _bucket_executor;
@@ -35,6 +36,7 @@ public:
 
     vespalib::ThreadExecutor& shared() override { return *_shared; }
     vespalib::ISequencedTaskExecutor& field_writer() override { return *_field_writer; }
+    vespalib::SimpleThreadBundle::Pool* index_sort_threads() override { return _index_sort_threads.get(); }
     vespalib::InvokeService & invokeService() override { return *_invokeService; }
     FNET_Transport & transport() override { return _transport; }
     storage::spi::BucketExecutor& bucket_executor() override { return _bucket_executor; }
@@ -21,6 +21,7 @@ public:
     ~MockSharedThreadingService() override;
     ThreadExecutor& shared() override { return _shared; }
     vespalib::ISequencedTaskExecutor& field_writer() override { return *_field_writer; }
+    vespalib::SimpleThreadBundle::Pool* index_sort_threads() override { return nullptr; }
     vespalib::InvokeService & invokeService() override { return _invokeService; }
     FNET_Transport & transport() override { return _transport.transport(); }
     storage::spi::BucketExecutor& bucket_executor() override { return _bucket_executor; }
@@ -51,6 +51,9 @@ public:
     vespalib::ISequencedTaskExecutor &field_writer() override {
         return _field_writer;
     }
+    vespalib::SimpleThreadBundle::Pool *index_sort_threads() override {
+        return _service.index_sort_threads();
+    }
 };
 
 }
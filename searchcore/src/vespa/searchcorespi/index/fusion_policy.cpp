@@ -0,0 +1,26 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "fusion_policy.h"
+#include <limits>
+
+namespace searchcorespi::index {
+
+double
+FusionPolicy::write_amplification(uint64_t fused_size, uint64_t unfused_size) noexcept
+{
+    if (unfused_size == 0) {
+        return (fused_size == 0) ? 1.0 : std::numeric_limits<double>::infinity();
+    }
+    return static_cast<double>(fused_size + unfused_size) / unfused_size;
+}
+
+bool
+FusionPolicy::should_fuse(uint32_t num_unfused, uint64_t fused_size, uint64_t unfused_size) const noexcept
+{
+    if (is_urgent(num_unfused) || _max_write_amplification <= 0.0) {
+        return true;
+    }
+    return write_amplification(fused_size, unfused_size) <= _max_write_amplification;
+}
+
+}
@@ -0,0 +1,47 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <cstdint>
+
+namespace searchcorespi::index {
+
+/**
+ * Policy deciding when the flushed disk indexes should be fused with
+ * the last fusion index.
+ *
+ * Each fusion rewrites the last fusion index together with all
+ * flushed indexes, thus the bytes written by fusion per flushed byte
+ * (write amplification) grows with the size of the last fusion index.
+ * Fusion is held back while its write amplification would exceed the
+ * configured max, letting the flushed indexes accumulate until they
+ * are large enough compared to the last fusion index. The number of
+ * disk indexes searched by each query is bounded by max flushed;
+ * fusion becomes urgent when this is exceeded.
+ *
+ * A max write amplification of 0 disables the bound, giving fusion
+ * whenever there are indexes to fuse.
+ */
+class FusionPolicy {
+    uint32_t _max_flushed;
+    double   _max_write_amplification;
+public:
+    FusionPolicy(uint32_t max_flushed, double max_write_amplification) noexcept
+        : _max_flushed(max_flushed),
+          _max_write_amplification(max_write_amplification)
+    {
+    }
+    uint32_t get_max_flushed() const noexcept { return _max_flushed; }
+    double get_max_write_amplification() const noexcept { return _max_write_amplification; }
+
+    /*
+     * Returns bytes written by fusing the given sizes divided by
+     * bytes in the flushed (not yet fused) indexes.
+     */
+    static double write_amplification(uint64_t fused_size, uint64_t unfused_size) noexcept;
+
+    bool is_urgent(uint32_t num_unfused) const noexcept { return num_unfused > _max_flushed; }
+    bool should_fuse(uint32_t num_unfused, uint64_t fused_size, uint64_t unfused_size) const noexcept;
+};
+
+}
@@ -201,6 +201,14 @@ public:
      */
     virtual void setMaxFlushed(uint32_t maxFlushed) = 0;
 
+    /*
+     * Sets the max write amplification (bytes written by fusion per flushed byte)
+     * allowed when fusion is not urgent. A value of 0 disables the bound.
+     *
+     * @param maxWriteAmplification   The max write amplification of a non-urgent fusion.
+     */
+    virtual void setMaxWriteAmplification(double maxWriteAmplification) = 0;
+
     /**
      * Checks if we have a pending urgent flush due to a recent
      * schema change (e.g. regeneration of interleaved features in
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "indexfusiontarget.h"
+#include "fusion_policy.h"
 #include <cinttypes>
 
 #include <vespa/log/log.h>
@@ -61,15 +62,24 @@ IndexFusionTarget::getApproxDiskGain() const
     uint64_t diskUsageBefore = _fusionStats.diskUsage;
     uint64_t diskUsageGain = static_cast<uint64_t>((0.1 * (diskUsageBefore * std::max(0,static_cast<int>(_fusionStats.numUnfused - 1)))));
     diskUsageGain = std::min(diskUsageGain, diskUsageBefore);
-    if (!_fusionStats._canRunFusion)
+    if (!_fusionStats._canRunFusion || !fusion_due())
         diskUsageGain = 0;
     return DiskGain(diskUsageBefore, diskUsageBefore - diskUsageGain);
 }
 
+bool
+IndexFusionTarget::fusion_due() const
+{
+    FusionPolicy policy(_fusionStats.maxFlushed, _fusionStats.maxWriteAmplification);
+    uint64_t unfused_disk_usage = _fusionStats.diskUsage - std::min(_fusionStats.diskUsage, _fusionStats.fusedDiskUsage);
+    return policy.should_fuse(_fusionStats.numUnfused, _fusionStats.fusedDiskUsage, unfused_disk_usage);
+}
+
 bool
 IndexFusionTarget::needUrgentFlush() const
 {
-    bool urgent = (_fusionStats.numUnfused > _fusionStats.maxFlushed || _indexMaintainer.urgent_disk_index_fusion()) &&
+    FusionPolicy policy(_fusionStats.maxFlushed, _fusionStats.maxWriteAmplification);
+    bool urgent = (policy.is_urgent(_fusionStats.numUnfused) || _indexMaintainer.urgent_disk_index_fusion()) &&
                   (_fusionStats._canRunFusion);
     LOG(debug, "Num flushed: %d Urgent: %d", _fusionStats.numUnfused, urgent);
     return urgent;
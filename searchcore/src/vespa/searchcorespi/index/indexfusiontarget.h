@@ -15,6 +15,8 @@ private:
     IndexMaintainer::FusionStats _fusionStats;
     FlushStats _lastStats;
 
+    bool fusion_due() const;
+
 public:
     IndexFusionTarget(IndexMaintainer &indexMaintainer);
     ~IndexFusionTarget() override;
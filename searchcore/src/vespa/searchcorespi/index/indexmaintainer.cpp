@@ -367,7 +367,9 @@ IndexMaintainer::flushMemoryIndex(IMemoryIndex &memoryIndex,
     IndexWriteUtilities::writeSourceSelector(saveInfo, indexId, getAttrTune(),
                                              _ctx.getFileHeaderContext(), serialNum);
     IndexWriteUtilities::writeSerialNum(serialNum, flushDir, _ctx.getFileHeaderContext());
-    return loadDiskIndex(flushDir);
+    auto disk_index = loadDiskIndex(flushDir);
+    _flush_bytes_written.fetch_add(disk_index->get_index_stats(false).sizeOnDisk(), std::memory_order_relaxed);
+    return disk_index;
 }
 
 std::unique_ptr<ISearchableIndexCollection>
@@ -882,6 +884,9 @@ IndexMaintainer::IndexMaintainer(const IndexMaintainerConfig &config,
       _fusion_spec(),
       _fusion_lock(),
       _maxFlushed(config.getMaxFlushed()),
+      _maxWriteAmplification(0.0),
+      _flush_bytes_written(0),
+      _fusion_bytes_written(0),
       _maxFrozen(10),
       _changeGens(),
       _schemaUpdateLock(),
@@ -1103,6 +1108,7 @@ IndexMaintainer::runFusion(const FusionSpec &fusion_spec, std::shared_ptr<search
     ChangeGens changeGens = getChangeGens();
     auto new_index(loadDiskIndex(new_fusion_dir));
     remove_fusion_index_guard.reset();
+    _fusion_bytes_written.fetch_add(new_index->get_index_stats(false).sizeOnDisk(), std::memory_order_relaxed);
 
     // Post processing after fusion operation has completed and new disk
     // index has been opened.
@@ -1177,20 +1183,33 @@ IndexMaintainer::getFusionStats() const
 {
     // Called by flush engine scheduler thread (from getFlushTargets())
     FusionStats stats;
-    std::shared_ptr<IndexSearchable> source_list;
+    std::shared_ptr<ISearchableIndexCollection> source_list;
 
     {
         LockGuard lock(_new_search_lock);
         source_list = _source_list;
         stats.maxFlushed = _maxFlushed;
+        stats.maxWriteAmplification = _maxWriteAmplification;
     }
     stats.diskUsage = source_list->get_index_stats(false).sizeOnDisk();
+    bool has_fusion_index = false;
     {
         LockGuard guard(_fusion_lock);
-        stats.numUnfused = _fusion_spec.flush_ids.size() + ((_fusion_spec.last_fusion_id != 0) ? 1 : 0);
+        has_fusion_index = (_fusion_spec.last_fusion_id != 0);
+        stats.numUnfused = _fusion_spec.flush_ids.size() + (has_fusion_index ? 1 : 0);
         stats._canRunFusion = canRunFusion(_fusion_spec);
     }
-    LOG(debug, "Get fusion stats. Disk usage: %" PRIu64 ", maxflushed: %d", stats.diskUsage, stats.maxFlushed);
+    if (has_fusion_index) {
+        // The last fusion index always has source id 0.
+        for (uint32_t i = 0; i < source_list->getSourceCount(); ++i) {
+            if (source_list->getSourceId(i) == 0) {
+                stats.fusedDiskUsage = source_list->getSearchable(i).get_index_stats(false).sizeOnDisk();
+                break;
+            }
+        }
+    }
+    LOG(debug, "Get fusion stats. Disk usage: %" PRIu64 ", fused disk usage: %" PRIu64 ", maxflushed: %d",
+        stats.diskUsage, stats.fusedDiskUsage, stats.maxFlushed);
     return stats;
 }
 
@@ -1341,6 +1360,26 @@ IndexMaintainer::setMaxFlushed(uint32_t maxFlushed)
     _maxFlushed = maxFlushed;
 }
 
+void
+IndexMaintainer::setMaxWriteAmplification(double maxWriteAmplification)
+{
+    LockGuard lock(_new_search_lock);
+    _maxWriteAmplification = maxWriteAmplification;
+}
+
+search::IndexStats
+IndexMaintainer::get_index_stats(bool clear_disk_io_stats) const
+{
+    search::IndexStats stats;
+    {
+        LockGuard lock(_new_search_lock);
+        stats = _source_list->get_index_stats(clear_disk_io_stats);
+    }
+    stats.flush_bytes_written(_flush_bytes_written.load(std::memory_order_relaxed));
+    stats.fusion_bytes_written(_fusion_bytes_written.load(std::memory_order_relaxed));
+    return stats;
+}
+
 void
 IndexMaintainer::consider_urgent_flush(const Schema& old_schema, const Schema& new_schema, uint32_t flush_id)
 {
@@ -133,6 +133,9 @@ class IndexMaintainer : public IIndexManager,
     FusionSpec                       _fusion_spec;       // Protected by FL
     mutable std::mutex               _fusion_lock;       // Fusion spec lock (FL)
     uint32_t                         _maxFlushed;        // Protected by NSL
+    double                           _maxWriteAmplification; // Protected by NSL
+    std::atomic<uint64_t>            _flush_bytes_written;
+    std::atomic<uint64_t>            _fusion_bytes_written;
     const uint32_t                   _maxFrozen;
     ChangeGens                       _changeGens;        // Protected by SL + IUL
     std::mutex                       _schemaUpdateLock;  // Serialize rewrite of schema
@@ -313,13 +316,17 @@ public:
     struct FusionStats {
         FusionStats()
             : diskUsage(0),
+              fusedDiskUsage(0),
               maxFlushed(0),
+              maxWriteAmplification(0.0),
               numUnfused(0),
               _canRunFusion(false)
         { }
 
         uint64_t diskUsage;
+        uint64_t fusedDiskUsage; // Disk usage of last fusion index
         uint32_t maxFlushed;
+        double   maxWriteAmplification;
         uint32_t numUnfused;
         bool _canRunFusion;
     };
@@ -360,14 +367,12 @@ public:
         return _source_list;
     }
 
-    search::IndexStats get_index_stats(bool clear_disk_io_stats) const override {
-        LockGuard lock(_new_search_lock);
-        return _source_list->get_index_stats(clear_disk_io_stats);
-    }
+    search::IndexStats get_index_stats(bool clear_disk_io_stats) const override;
 
     IFlushTarget::List getFlushTargets() override;
     void setSchema(const Schema & schema, SerialNum serialNum) override ;
     void setMaxFlushed(uint32_t maxFlushed) override;
+    void setMaxWriteAmplification(double maxWriteAmplification) override;
     void consider_urgent_flush(const Schema& old_schema, const Schema& new_schema, uint32_t flush_id);
     void consider_initial_urgent_flush();
     uint32_t get_urgent_flush_id() const;
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "i_thread_service.h"
+#include <vespa/vespalib/util/simple_thread_bundle.h>
 
 class FNET_Transport;
 
@@ -66,6 +67,8 @@ struct IThreadingService
     virtual vespalib::Executor &shared() = 0;
     virtual FNET_Transport &transport() = 0;
     virtual vespalib::ISequencedTaskExecutor &field_writer() = 0;
+    // Shared pool of thread bundles used to sort inverted positions, nullptr if not in use.
+    virtual vespalib::SimpleThreadBundle::Pool *index_sort_threads() = 0;
 };
 
 }
@@ -3,6 +3,8 @@
 #include <vespa/searchlib/attribute/enumstore.hpp>
 #include <vespa/searchlib/attribute/enum_store_loaders.h>
 #include <vespa/vespalib/test/memory_allocator_observer.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
+#include <random>
 #include <vespa/vespalib/gtest/gtest.h>
 
 #include <vespa/log/log.h>
@@ -642,6 +644,52 @@ TYPED_TEST(LoaderTest, store_is_instantiated_with_non_enumerated_loader)
     this->expect_posting_idx(3, 103);
 }
 
+namespace {
+
+attribute::LoadedEnumAttributeVector
+make_loaded_enums(size_t num_values, uint32_t num_enums)
+{
+    attribute::LoadedEnumAttributeVector loaded;
+    loaded.reserve(num_values);
+    std::minstd_rand rnd(42);
+    for (size_t i = 0; i < num_values; ++i) {
+        // Skewed enum distribution: every fourth value refers to enum 7
+        uint32_t e = ((i % 4) == 0) ? 7 : (rnd() % num_enums);
+        loaded.emplace_back(e, rnd() % 1000000, int32_t(i));
+    }
+    return loaded;
+}
+
+bool
+same_enum_and_docid(const attribute::LoadedEnumAttributeVector& lhs, const attribute::LoadedEnumAttributeVector& rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                      [](const auto& a, const auto& b) { return a.getEnum() == b.getEnum() && a.getDocId() == b.getDocId(); });
+}
+
+}
+
+TEST(LoadedEnumSortTest, parallel_sort_gives_same_order_as_serial_sort)
+{
+    vespalib::ThreadStackExecutor executor(4);
+    for (uint32_t num_enums : {1u, 3u, 1000u, 100000u}) {
+        SCOPED_TRACE(num_enums);
+        auto expected = make_loaded_enums(2000000, num_enums);
+        auto actual = expected;
+        attribute::sortLoadedByEnum(expected);
+        attribute::sortLoadedByEnum(actual, num_enums, &executor);
+        EXPECT_TRUE(same_enum_and_docid(expected, actual));
+        EXPECT_TRUE(std::is_sorted(actual.begin(), actual.end(), attribute::LoadedEnumAttribute::EnumCompare()));
+    }
+}
+
+TEST(LoadedEnumSortTest, small_input_is_sorted_without_executor)
+{
+    auto loaded = make_loaded_enums(1000, 10);
+    attribute::sortLoadedByEnum(loaded, 10, nullptr);
+    EXPECT_TRUE(std::is_sorted(loaded.begin(), loaded.end(), attribute::LoadedEnumAttribute::EnumCompare()));
+}
+
 template <typename EnumStoreTypeAndDictionaryType>
 class EnumStoreDictionaryTest : public ::testing::Test {
 public:
@@ -224,6 +224,12 @@ public:
         set(docId, {});
         _refMapping.erase(docId);
     }
+
+    void updateDoc(uint32_t docId) {
+        std::vector<int> values = makeValues();
+        _refMapping[docId] = values;
+        set(docId, values);
+    }
 };
 
 TEST_F(IntMappingTest, test_that_set_and_get_works)
@@ -375,4 +381,35 @@ TEST_F(CompactionIntMappingTest, test_that_compaction_works)
     EXPECT_LT(bufferCountAfter, bufferCountBefore);
 }
 
+TEST_F(CompactionIntMappingTest, test_that_incremental_compaction_works_with_updates_between_slices)
+{
+    setup(3, 64, 512, 129);
+    _mvMapping->set_compaction_slice_time_budget(vespalib::duration::zero());
+    constexpr uint32_t chunk_lids = MvMapping::compaction_chunk_lids;
+    addRandomDocs(3 * chunk_lids + 100);
+    uint32_t docIdLimit = size();
+    for (uint32_t docId = 0; docId < docIdLimit; docId += 2) {
+        clearDoc(docId);
+    }
+    uint32_t bufferCountBefore = countBuffers();
+    _mvMapping->set_compaction_spec(CompactionSpec(true, false));
+    CompactionStrategy compaction_strategy;
+    uint32_t slices = 0;
+    do {
+        EXPECT_TRUE(_mvMapping->consider_compact(compaction_strategy));
+        ++slices;
+        // Update docs both before and after the lids handled so far
+        updateDoc(1 + 2 * (slices % 7));
+        updateDoc(docIdLimit - 1 - 2 * slices);
+        _attr->commit();
+        _attr->incGeneration();
+        checkRefMapping();
+    } while (_mvMapping->has_compaction_in_progress());
+    EXPECT_EQ(4u, slices);
+    _attr->commit();
+    _attr->incGeneration();
+    EXPECT_LT(countBuffers(), bufferCountBefore);
+    checkRefMapping();
+}
+
 GTEST_MAIN_RUN_ALL_TESTS()
@@ -3,11 +3,38 @@
 #include <vespa/searchlib/diskindex/zc_decoder_validator.h>
 #include <vespa/searchlib/diskindex/zcbuf.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
 #include <limits>
+#include <random>
 
 using search::diskindex::ZcBuf;
+using search::diskindex::ZcDecoder;
 using search::diskindex::ZcDecoderValidator;
 
+namespace {
+
+// Decode docids one at a time until reaching limit, returning the first docid >= limit.
+uint32_t
+seek_scalar(ZcDecoder& decoder, uint32_t doc_id, uint32_t limit)
+{
+    while (doc_id < limit) {
+        doc_id += 1 + decoder.decode32();
+    }
+    return doc_id;
+}
+
+uint32_t
+seek_skip_small(ZcDecoder& decoder, uint32_t doc_id, uint32_t limit)
+{
+    while (doc_id < limit) {
+        decoder.skip_small_docid_deltas(doc_id, limit);
+        doc_id += 1 + decoder.decode32();
+    }
+    return doc_id;
+}
+
+}
+
 class ZcTest : public ::testing::Test
 {
 protected:
@@ -108,6 +135,82 @@ TEST_F(ZcTest, encode_then_decode_should_give_original_result)
     EXPECT_EQ(5, encode_used_bytes(std::numeric_limits<uint32_t>::max()));
 }
 
+TEST_F(ZcTest, skip_small_docid_deltas_gives_same_result_as_decoding_each_delta)
+{
+    std::mt19937 rng(42);
+    std::vector<uint32_t> doc_ids;
+    uint32_t doc_id = 0;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        // Mostly single byte deltas with some runs of larger deltas.
+        uint32_t delta = ((i / 100) % 5 == 4) ? (rng() % 20000) : (rng() % 128);
+        _zc_buf.encode32(delta);
+        doc_id += 1 + delta;
+        doc_ids.push_back(doc_id);
+    }
+    uint32_t last_doc_id = doc_id;
+    for (uint32_t i = 0; i < 16; ++i) {
+        _zc_buf.encode32(0); // padding
+    }
+    for (uint32_t step : {13u, 64u, 1000u, 100000u}) {
+        SCOPED_TRACE(std::string("step=") + std::to_string(step));
+        ZcDecoderValidator scalar(_zc_buf.view());
+        ZcDecoderValidator skipping(_zc_buf.view());
+        uint32_t scalar_doc_id = 0;
+        uint32_t skipping_doc_id = 0;
+        for (uint32_t limit = 1; limit <= last_doc_id; limit += step) {
+            scalar_doc_id = seek_scalar(scalar, scalar_doc_id, limit);
+            skipping_doc_id = seek_skip_small(skipping, skipping_doc_id, limit);
+            ASSERT_EQ(scalar_doc_id, skipping_doc_id);
+            ASSERT_EQ(scalar.pos(), skipping.pos());
+        }
+        EXPECT_TRUE(std::binary_search(doc_ids.begin(), doc_ids.end(), scalar_doc_id));
+    }
+}
+
+TEST_F(ZcTest, skip_small_docid_deltas_stops_at_multi_byte_delta)
+{
+    for (uint32_t i = 0; i < 20; ++i) {
+        _zc_buf.encode32(1);
+    }
+    _zc_buf.encode32(1000);
+    for (uint32_t i = 0; i < 16; ++i) {
+        _zc_buf.encode32(0);
+    }
+    ZcDecoderValidator decoder(_zc_buf.view());
+    uint32_t doc_id = 0;
+    EXPECT_EQ(16u, decoder.skip_small_docid_deltas(doc_id, 1000000));
+    EXPECT_EQ(32u, doc_id);
+    EXPECT_EQ(16u, decoder.pos());
+    EXPECT_EQ(0u, decoder.skip_small_docid_deltas(doc_id, 1000000));
+}
+
+TEST_F(ZcTest, DISABLED_seek_speed_dense_docid_deltas)
+{
+    std::mt19937 rng(42);
+    for (uint32_t i = 0; i < 1000000; ++i) {
+        _zc_buf.encode32(rng() % 4);
+    }
+    for (uint32_t i = 0; i < 16; ++i) {
+        _zc_buf.encode32(0);
+    }
+    uint32_t result = 0;
+    for (bool skip_small : {false, true}) {
+        vespalib::BenchmarkTimer timer(2.0);
+        while (timer.has_budget()) {
+            timer.before();
+            ZcDecoder decoder(_zc_buf.view().data());
+            uint32_t doc_id = 0;
+            for (uint32_t limit = 1000; limit < 2000000; limit += 1000) {
+                doc_id = skip_small ? seek_skip_small(decoder, doc_id, limit) : seek_scalar(decoder, doc_id, limit);
+            }
+            result += doc_id;
+            timer.after();
+        }
+        fprintf(stderr, "%s: %.3f ms\n", skip_small ? "skip small deltas" : "decode each delta", timer.min_time() * 1000.0);
+    }
+    EXPECT_NE(0u, result);
+}
+
 TEST_F(ZcTest, DISABLED_decode_speed_decoder)
 {
     fill();
@@ -360,6 +360,14 @@ TEST(PropertiesTest, test_stuff)
             p.add("vespa.matchphase.degradation.postfiltermultiplier", "0.9");
             EXPECT_EQ(matchphase::DegradationPostFilterMultiplier::lookup(p), 0.9);
         }
+        { // vespa.matchphase.degradation.fromsort
+            EXPECT_EQ(matchphase::DegradationFromSort::NAME, std::string("vespa.matchphase.degradation.fromsort"));
+            EXPECT_EQ(matchphase::DegradationFromSort::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_EQ(matchphase::DegradationFromSort::lookup(p), false);
+            p.add("vespa.matchphase.degradation.fromsort", "true");
+            EXPECT_EQ(matchphase::DegradationFromSort::lookup(p), true);
+        }
         { // vespa.matchphase.diversity.attribute
             EXPECT_EQ(matchphase::DiversityAttribute::NAME, std::string("vespa.matchphase.diversity.attribute"));
             EXPECT_EQ(matchphase::DiversityAttribute::DEFAULT_VALUE, "");
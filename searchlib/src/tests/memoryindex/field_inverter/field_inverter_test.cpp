@@ -17,6 +17,7 @@
 #include <vespa/searchlib/test/memoryindex/ordered_field_index_inserter_backend.h>
 #include <vespa/vespalib/objects/nbostream.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <vespa/vespalib/util/stringfmt.h>
 
 namespace search::memoryindex {
 
@@ -471,6 +472,39 @@ TEST_F(FieldInverterTest, bad_index_field_is_ignored)
     EXPECT_EQ("", _inserter_backend.toStr());
 }
 
+TEST_F(FieldInverterTest, parallel_sort_of_positions_gives_same_result_as_serial_sort)
+{
+    test::OrderedFieldIndexInserterBackend parallel_backend;
+    test::OrderedFieldIndexInserter parallel_inserter(parallel_backend, 0);
+    FieldLengthCalculator parallel_calculator;
+    vespalib::SimpleThreadBundle::Pool sort_threads(4);
+    FieldInverter parallel_inverter(_schema, 0, _remover, parallel_inserter, parallel_calculator, &sort_threads);
+    constexpr uint32_t num_docs = 2000;
+    constexpr uint32_t words_per_doc = 80;
+    static_assert(num_docs * words_per_doc >= 2 * FieldInverter::min_positions_per_sort_shard);
+    StringFieldBuilder sfb(_b);
+    for (uint32_t docId = 1; docId <= num_docs; ++docId) {
+        std::string text;
+        for (uint32_t i = 0; i < words_per_doc; ++i) {
+            // Skewed word distribution, some words occur in all documents.
+            uint32_t word = (i < 8) ? i : (docId * 7 + i * i) % 3000;
+            text += vespalib::make_string("%sw%u", (i > 0) ? " " : "", word);
+        }
+        auto doc = _b.make_document(vespalib::make_string("id:ns:searchdocument::%u", docId));
+        doc->setValue("f0", sfb.tokenize(text).build());
+        _inverters[0]->invertField(docId, doc->getValue("f0"), *doc);
+        parallel_inverter.invertField(docId, doc->getValue("f0"), *doc);
+    }
+    _inverters[0]->remove("w5", num_docs + 1);
+    parallel_inverter.remove("w5", num_docs + 1);
+    _inserter_backend.setVerbose();
+    parallel_backend.setVerbose();
+    _inverters[0]->pushDocuments();
+    parallel_inverter.pushDocuments();
+    EXPECT_EQ(_inserter_backend.toStr(), parallel_backend.toStr());
+    EXPECT_NE(std::string::npos, parallel_backend.toStr().find("w=w5,"));
+}
+
 }
 
 GTEST_MAIN_RUN_ALL_TESTS()
@@ -6,6 +6,10 @@
 #include <vespa/searchlib/queryeval/predicate_search.h>
 #include <vespa/vespalib/gtest/gtest.h>
 #include <vespa/vespalib/util/arraysize.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
 
 #include <vespa/log/log.h>
 LOG_SETUP("predicate_search_test");
@@ -371,6 +375,63 @@ TEST(PredicateSearchTest, require_that_subquery_bitmap_is_unpacked_to_subqueries
 }
 
 
+// Synthetic ad-targeting corpus: each document is a conjunction of 2-4
+// attribute constraints, each accepting a small set of values. Conjunct
+// j of a document covers interval [j, j] and the document is a match
+// when the query covers all of [1, number of conjuncts].
+TEST(PredicateSearchTest, DISABLED_benchmark_ad_targeting_predicates) {
+    constexpr uint32_t num_docs = 200'000;
+    const vector<uint32_t> attribute_values = {50, 10, 3, 5, 100}; // country, age, gender, device, interest
+    const vector<vector<uint32_t>> query_values = {{7}, {3}, {1}, {2}, {5, 17, 42}};
+    uint32_t num_posting_lists = 0;
+    for (const auto &values : query_values) {
+        num_posting_lists += values.size();
+    }
+    std::mt19937 rnd(42);
+    vector<vector<pair<uint32_t, uint32_t>>> entries(num_posting_lists);
+    vector<uint8_t> min_feature(num_docs, 0);
+    vector<uint8_t> kv(num_docs, 0);
+    vector<uint16_t> interval_range(num_docs, 0x1);
+    vector<uint32_t> conjunct(attribute_values.size());
+    for (uint32_t doc_id = 1; doc_id < num_docs; ++doc_id) {
+        // conjunct[attr] is the (1-based) position of the constraint on attr, or 0 if unconstrained.
+        uint32_t num_conjuncts = 2 + rnd() % 3;
+        std::iota(conjunct.begin(), conjunct.end(), 1);
+        std::shuffle(conjunct.begin(), conjunct.end(), rnd);
+        uint32_t list = 0;
+        for (uint32_t attr = 0; attr < attribute_values.size(); ++attr) {
+            uint32_t j = conjunct[attr];
+            uint32_t num_accepted = 1 + rnd() % attribute_values[attr];
+            for (size_t i = 0; i < query_values[attr].size(); ++i, ++list) {
+                if (j <= num_conjuncts && rnd() % attribute_values[attr] < num_accepted) {
+                    entries[list].emplace_back(doc_id, (j << 16) | j);
+                    ++kv[doc_id];
+                }
+            }
+        }
+        min_feature[doc_id] = num_conjuncts;
+        interval_range[doc_id] = num_conjuncts;
+    }
+    uint32_t hits = 0;
+    vespalib::BenchmarkTimer timer(5.0);
+    while (timer.has_budget()) {
+        vector<PredicatePostingList::UP> posting_lists;
+        for (const auto &e : entries) {
+            posting_lists.emplace_back(std::make_unique<MyPostingList>(e));
+        }
+        PredicateSearch search(&min_feature[0], &interval_range[0], 0xffff, kv,
+                               std::move(posting_lists), TermFieldMatchDataArray());
+        timer.before();
+        search.initRange(1, num_docs);
+        hits = 0;
+        for (uint32_t doc_id = search.seekFirst(1); doc_id < num_docs; doc_id = search.seekFirst(doc_id + 1)) {
+            ++hits;
+        }
+        timer.after();
+    }
+    fprintf(stderr, "%u of %u documents matched, %g ms per evaluation\n", hits, num_docs, timer.min_time() * 1000.0);
+}
+
 }  // namespace
 
 GTEST_MAIN_RUN_ALL_TESTS()
@@ -540,6 +540,7 @@ TEST_F(RankSetupTest, rank_setup)
     env.getProperties().add(matchphase::DegradationMaxFilterCoverage::NAME, "0.19");
     env.getProperties().add(matchphase::DegradationSamplePercentage::NAME, "0.9");
     env.getProperties().add(matchphase::DegradationPostFilterMultiplier::NAME, "0.7");
+    env.getProperties().add(matchphase::DegradationFromSort::NAME, "true");
     env.getProperties().add(matchphase::DiversityAttribute::NAME, "mycategoryattr");
     env.getProperties().add(matchphase::DiversityMinGroups::NAME, "37");
     env.getProperties().add(matchphase::DiversityCutoffFactor::NAME, "7.1");
@@ -588,6 +589,7 @@ TEST_F(RankSetupTest, rank_setup)
     EXPECT_EQ(rs.getDegradationSamplePercentage(), 0.9);
     EXPECT_EQ(rs.getDegradationMaxFilterCoverage(), 0.19);
     EXPECT_EQ(rs.getDegradationPostFilterMultiplier(), 0.7);
+    EXPECT_EQ(rs.isDegradationFromSort(), true);
     EXPECT_EQ(rs.getDiversityAttribute(), "mycategoryattr");
     EXPECT_EQ(rs.getDiversityMinGroups(), 37u);
     EXPECT_EQ(rs.getDiversityCutoffFactor(), 7.1);
@@ -13,6 +13,8 @@
 #include <vespa/searchlib/uca/ucaconverter.h>
 #include <vespa/vespalib/gtest/gtest.h>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <algorithm>
 #include <type_traits>
 #include <cinttypes>
 #include <vespa/log/log.h>
@@ -455,6 +457,70 @@ TEST(SortTest, test_that_docid_uses_attribute_when_one_exists) {
     EXPECT_EQ(0, memcmp(SECOND_DESC, sr2.first, 8));
 }
 
+void
+verify_top_k_sort_matches_full_sort(const std::string & sortSpec, search::attribute::IAttributeContext & ac, uint32_t num, uint32_t topn)
+{
+    SCOPED_TRACE(sortSpec);
+    search::uca::UcaConverterFactory ucaFactory;
+    std::vector<RankedHit> hits;
+    for (uint32_t i = 0; i < num; ++i) {
+        hits.emplace_back(i, double(i % 17));
+    }
+    std::vector<RankedHit> topHits = hits;
+    FastS_SortSpec full("no-metastore", 7, vespalib::Doom::never(), ucaFactory);
+    ASSERT_TRUE(full.Init(sortSpec, ac));
+    full.sortResults(hits.data(), num, num);
+    FastS_SortSpec top("no-metastore", 7, vespalib::Doom::never(), ucaFactory);
+    ASSERT_TRUE(top.Init(sortSpec, ac));
+    top.sortResults(topHits.data(), num, topn);
+    for (uint32_t i = 0; i < topn; ++i) {
+        EXPECT_EQ(hits[i].getDocId(), topHits[i].getDocId());
+        EXPECT_EQ(hits[i].getRank(), topHits[i].getRank());
+        auto expRef = full.getSortRef(i);
+        auto actRef = top.getSortRef(i);
+        ASSERT_EQ(expRef.second, actRef.second);
+        EXPECT_EQ(0, memcmp(expRef.first, actRef.first, expRef.second));
+    }
+    std::vector<uint32_t> allDocIds;
+    for (const auto & hit : topHits) {
+        allDocIds.push_back(hit.getDocId());
+    }
+    std::sort(allDocIds.begin(), allDocIds.end());
+    for (uint32_t i = 0; i < num; ++i) {
+        EXPECT_EQ(i, allDocIds[i]);
+    }
+}
+
+TEST(SortTest, top_k_sort_on_single_value_numeric_gives_same_top_hits_as_full_sort) {
+    constexpr uint32_t num = 1000;
+    auto ts = AttributeFactory::createAttribute("ts", Config(BasicType::INT64, CollectionType::SINGLE));
+    auto price = AttributeFactory::createAttribute("price", Config(BasicType::FLOAT, CollectionType::SINGLE));
+    auto name = AttributeFactory::createAttribute("name", Config(BasicType::STRING, CollectionType::SINGLE));
+    ASSERT_TRUE(ts->addDocs(num));
+    ASSERT_TRUE(price->addDocs(num));
+    ASSERT_TRUE(name->addDocs(num));
+    for (uint32_t lid = 0; lid < num; ++lid) {
+        dynamic_cast<IntegerAttribute &>(*ts).update(lid, (lid * 7919) % 13); // Many ties
+        dynamic_cast<FloatingPointAttribute &>(*price).update(lid, float((lid * 104729) % 1009) - 500.0f);
+        dynamic_cast<StringAttribute &>(*name).update(lid, vespalib::make_string("name%u", (lid * 31) % 97));
+    }
+    ts->commit();
+    price->commit();
+    name->commit();
+    search::AttributeManager mgr;
+    mgr.add(ts);
+    mgr.add(price);
+    mgr.add(name);
+    search::AttributeContext ac(mgr);
+    for (uint32_t topn : {1u, 10u, 100u}) {
+        verify_top_k_sort_matches_full_sort("-ts +[docid]", ac, num, topn);
+        verify_top_k_sort_matches_full_sort("+ts -[rank] -[docid]", ac, num, topn);
+        verify_top_k_sort_matches_full_sort("+price", ac, num, topn);
+        verify_top_k_sort_matches_full_sort("-price", ac, num, topn);
+        verify_top_k_sort_matches_full_sort("+name +[docid]", ac, num, topn);
+    }
+}
+
 using search::string_to_number;
 
 TEST(SortTest, string_to_number_for_missing_value_in_sort_spec) {
@@ -11,6 +11,8 @@ TEST(IndexStatsTest, stats_can_be_merged)
     EXPECT_EQ(0u, stats.docsInMemory());
     EXPECT_EQ(0u, stats.sizeOnDisk());
     EXPECT_EQ(0u, stats.fusion_size_on_disk());
+    EXPECT_EQ(0u, stats.flush_bytes_written());
+    EXPECT_EQ(0u, stats.fusion_bytes_written());
     EXPECT_EQ(0, stats.disk_indexes());
     EXPECT_EQ(0, stats.memory_indexes());
     {
@@ -19,6 +21,8 @@ TEST(IndexStatsTest, stats_can_be_merged)
         EXPECT_EQ(&rhs.docsInMemory(10), &rhs);
         EXPECT_EQ(&rhs.sizeOnDisk(1000), &rhs);
         EXPECT_EQ(&rhs.fusion_size_on_disk(500), &rhs);
+        EXPECT_EQ(&rhs.flush_bytes_written(300), &rhs);
+        EXPECT_EQ(&rhs.fusion_bytes_written(900), &rhs);
         EXPECT_EQ(&rhs.memory_indexes(1), &rhs);
         EXPECT_EQ(&stats.merge(rhs), &stats);
     }
@@ -26,17 +30,22 @@ TEST(IndexStatsTest, stats_can_be_merged)
     EXPECT_EQ(10u, stats.docsInMemory());
     EXPECT_EQ(1000u, stats.sizeOnDisk());
     EXPECT_EQ(500u, stats.fusion_size_on_disk());
+    EXPECT_EQ(300u, stats.flush_bytes_written());
+    EXPECT_EQ(900u, stats.fusion_bytes_written());
     EXPECT_EQ(1, stats.memory_indexes());
 
     stats.merge(IndexStats()
                         .memoryUsage(vespalib::MemoryUsage(150,0,0,0))
                         .docsInMemory(15)
                         .sizeOnDisk(1500)
-                        .fusion_size_on_disk(800).disk_indexes(2));
+                        .fusion_size_on_disk(800).disk_indexes(2)
+                        .flush_bytes_written(200).fusion_bytes_written(1100));
     EXPECT_EQ(250u, stats.memoryUsage().allocatedBytes());
     EXPECT_EQ(25u, stats.docsInMemory());
     EXPECT_EQ(2500u, stats.sizeOnDisk());
     EXPECT_EQ(1300u, stats.fusion_size_on_disk());
+    EXPECT_EQ(500u, stats.flush_bytes_written());
+    EXPECT_EQ(2000u, stats.fusion_bytes_written());
     EXPECT_EQ(2, stats.disk_indexes());
 }
 
@@ -101,7 +101,8 @@ EnumeratedPostingsLoader::EnumeratedPostingsLoader(IEnumStore& store)
     : EnumeratedLoaderBase(store),
       _loaded_enums(),
       _posting_indexes(),
-      _has_btree_dictionary(_store.get_dictionary().get_has_btree_dictionary())
+      _has_btree_dictionary(_store.get_dictionary().get_has_btree_dictionary()),
+      _sort_executor(nullptr)
 {
 }
 
@@ -6,6 +6,7 @@
 #include "loadedenumvalue.h"
 
 namespace search { class IEnumStore; }
+namespace vespalib { class Executor; }
 
 namespace search::enumstore {
 
@@ -66,6 +67,7 @@ private:
     attribute::LoadedEnumAttributeVector _loaded_enums;
     EntryRefVector                       _posting_indexes;
     bool                                 _has_btree_dictionary;
+    vespalib::Executor*                  _sort_executor; // Used to sort large sets of loaded enums in parallel
 
 public:
     EnumeratedPostingsLoader(IEnumStore& store);
@@ -78,8 +80,9 @@ public:
     void reserve_loaded_enums(size_t num_values) {
         _loaded_enums.reserve(num_values);
     }
+    void set_sort_executor(vespalib::Executor* executor) noexcept { _sort_executor = executor; }
     void sort_loaded_enums() {
-        attribute::sortLoadedByEnum(_loaded_enums);
+        attribute::sortLoadedByEnum(_loaded_enums, _indexes.size(), _sort_executor);
     }
     bool is_folded_change(Index lhs, Index rhs) const;
     void set_ref_count(Index idx, uint32_t ref_count);
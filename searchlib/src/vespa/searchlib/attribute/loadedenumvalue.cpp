@@ -2,19 +2,117 @@
 
 #include "loadedenumvalue.h"
 #include <vespa/searchlib/common/sort.h>
+#include <vespa/vespalib/util/count_down_latch.h>
+#include <vespa/vespalib/util/cpu_usage.h>
+#include <vespa/vespalib/util/lambdatask.h>
+#include <vespa/vespalib/util/size_literals.h>
+#include <algorithm>
 
 namespace search::attribute {
 
+namespace {
+
+// Below this number of loaded values per shard, the cost of partitioning is not worth it.
+constexpr size_t min_values_per_sort_shard = 256_Ki;
+constexpr uint32_t max_sort_shards = 16;
+
 void
-sortLoadedByEnum(LoadedEnumAttributeVector &loaded)
+sort_range(LoadedEnumAttribute *begin, size_t size)
 {
     ShiftBasedRadixSorter<LoadedEnumAttribute,
         LoadedEnumAttribute::EnumRadix,
         LoadedEnumAttribute::EnumCompare, 56>::
         radix_sort(LoadedEnumAttribute::EnumRadix(),
                    LoadedEnumAttribute::EnumCompare(),
-                   loaded.data(), loaded.size(), 16);
+                   begin, size, 16);
+}
+
+/*
+ * Split the enum space into at most num_shards consecutive ranges with
+ * approximately the same number of loaded values. Returns the shard
+ * for each enum value.
+ */
+std::vector<uint8_t>
+make_enum_to_shard(const LoadedEnumAttributeVector &loaded, uint32_t num_enums, uint32_t num_shards)
+{
+    std::vector<uint32_t> hist(num_enums, 0);
+    for (const auto &elem : loaded) {
+        ++hist[elem.getEnum()];
+    }
+    std::vector<uint8_t> enum_to_shard(num_enums, 0);
+    uint32_t shard = 0;
+    size_t accumulated = 0;
+    for (uint32_t e = 0; e < num_enums; ++e) {
+        enum_to_shard[e] = shard;
+        accumulated += hist[e];
+        if (accumulated * num_shards >= loaded.size() * (shard + 1) && shard + 1 < num_shards) {
+            ++shard;
+        }
+    }
+    return enum_to_shard;
 }
 
+/*
+ * Permute loaded in place so that values belonging to the same shard
+ * are stored consecutively, in shard order. Returns the start offset
+ * of each shard, followed by the total number of values.
+ */
+std::vector<size_t>
+partition_by_shard(LoadedEnumAttributeVector &loaded, const std::vector<uint8_t> &enum_to_shard, uint32_t num_shards)
+{
+    std::vector<size_t> start(num_shards + 1, 0);
+    for (const auto &elem : loaded) {
+        ++start[enum_to_shard[elem.getEnum()] + 1];
+    }
+    for (uint32_t s = 0; s < num_shards; ++s) {
+        start[s + 1] += start[s];
+    }
+    std::vector<size_t> next(start.begin(), start.end() - 1);
+    for (uint32_t s = 0; s < num_shards; ++s) {
+        while (next[s] < start[s + 1]) {
+            LoadedEnumAttribute value = loaded[next[s]];
+            uint32_t target = enum_to_shard[value.getEnum()];
+            while (target != s) {
+                std::swap(value, loaded[next[target]++]);
+                target = enum_to_shard[value.getEnum()];
+            }
+            loaded[next[s]++] = value;
+        }
+    }
+    return start;
 }
 
+}
+
+void
+sortLoadedByEnum(LoadedEnumAttributeVector &loaded)
+{
+    sort_range(loaded.data(), loaded.size());
+}
+
+void
+sortLoadedByEnum(LoadedEnumAttributeVector &loaded, uint32_t num_enums, vespalib::Executor *executor)
+{
+    size_t max_shards_by_size = loaded.size() / min_values_per_sort_shard;
+    if (executor == nullptr || max_shards_by_size < 2) {
+        sortLoadedByEnum(loaded);
+        return;
+    }
+    uint32_t num_shards = std::min(size_t(max_sort_shards), max_shards_by_size);
+    auto start = partition_by_shard(loaded, make_enum_to_shard(loaded, num_enums, num_shards), num_shards);
+    vespalib::CountDownLatch latch(num_shards - 1);
+    for (uint32_t s = 1; s < num_shards; ++s) {
+        auto task = vespalib::makeLambdaTask([&loaded, &start, &latch, s]() {
+            sort_range(loaded.data() + start[s], start[s + 1] - start[s]);
+            latch.countDown();
+        });
+        auto rejected = executor->execute(vespalib::CpuUsage::wrap(std::move(task), vespalib::CpuUsage::Category::SETUP));
+        if (rejected) {
+            rejected->run();
+        }
+    }
+    sort_range(loaded.data() + start[0], start[1] - start[0]);
+    latch.await();
+}
+
+}
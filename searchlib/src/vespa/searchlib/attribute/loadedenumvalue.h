@@ -7,6 +7,8 @@
 #include <limits>
 #include <span>
 
+namespace vespalib { class Executor; }
+
 namespace search::attribute {
 
 /**
@@ -139,4 +141,11 @@ public:
 
 void sortLoadedByEnum(LoadedEnumAttributeVector &loaded);
 
+/**
+ * Sort loaded enumerated attribute by enum and docid, using the given
+ * executor (if any) to sort disjoint enum ranges in parallel. All enum
+ * values in loaded must be less than num_enums.
+ */
+void sortLoadedByEnum(LoadedEnumAttributeVector &loaded, uint32_t num_enums, vespalib::Executor *executor);
+
 }
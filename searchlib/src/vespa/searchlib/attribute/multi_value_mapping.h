@@ -7,7 +7,9 @@
 #include <vespa/vespalib/datastore/array_store.h>
 #include <vespa/vespalib/datastore/array_store_dynamic_type_mapper.h>
 #include <vespa/vespalib/datastore/dynamic_array_buffer_type.h>
+#include <vespa/vespalib/datastore/i_compaction_context.h>
 #include <vespa/vespalib/util/address_space.h>
+#include <vespa/vespalib/util/time.h>
 
 namespace search::attribute {
 
@@ -24,6 +26,9 @@ public:
 
     static constexpr double array_store_grow_factor = 1.03;
     static constexpr uint32_t array_store_max_type_id = 300;
+    // Incremental compaction handles lids in chunks of this size until the time budget for the slice is used.
+    static constexpr uint32_t compaction_chunk_lids = 4096;
+    static constexpr vespalib::duration default_compaction_slice_time_budget = 1ms;
 private:
     using ArrayRef = std::span<ElemT>;
     using ArrayStoreTypeMapper = vespalib::datastore::ArrayStoreDynamicTypeMapper<ElemT>;
@@ -32,6 +37,12 @@ private:
     using ConstArrayRef = std::span<const ElemT>;
 
     ArrayStore _store;
+    vespalib::datastore::ICompactionContext::UP _compaction_context; // Ongoing incremental compaction, if any
+    uint32_t _compaction_lid; // First lid not yet handled by ongoing incremental compaction
+    vespalib::duration _compaction_slice_time_budget;
+
+    void compact_slice();
+    void finish_compaction();
 public:
     MultiValueMapping(const MultiValueMapping &) = delete;
     MultiValueMapping & operator = (const MultiValueMapping &) = delete;
@@ -64,17 +75,21 @@ public:
     vespalib::AddressSpace getAddressSpaceUsage() const override;
     vespalib::MemoryUsage getArrayStoreMemoryUsage() const override;
     vespalib::MemoryUsage update_stat(const CompactionStrategy& compaction_strategy);
-    bool consider_compact(const CompactionStrategy &compactionStrategy) {
-        if (_store.consider_compact()) {
-            compact_worst(compactionStrategy);
-            return true;
-        }
-        return false;
-    }
+    /*
+     * Compaction is performed incrementally, one time bounded slice of
+     * the lid space per call, to avoid stalling the write thread. Returns
+     * true if a slice was compacted, i.e. the caller should bump the
+     * generation and update statistics.
+     */
+    bool consider_compact(const CompactionStrategy &compactionStrategy);
+    // Compact worst buffers in one go, finishing any ongoing incremental compaction first.
     void compact_worst(const CompactionStrategy& compaction_strategy);
+    bool has_compaction_in_progress() const noexcept { return static_cast<bool>(_compaction_context); }
     bool has_free_lists_enabled() const { return _store.has_free_lists_enabled(); }
     // Set compaction spec. Only used by unit tests.
     void set_compaction_spec(vespalib::datastore::CompactionSpec compaction_spec) noexcept { _store.set_compaction_spec(compaction_spec); }
+    // Set time budget for each incremental compaction slice. Only used by unit tests.
+    void set_compaction_slice_time_budget(vespalib::duration budget) noexcept { _compaction_slice_time_budget = budget; }
     // Get type mapper. Only used by unit tests.
     const ArrayStoreTypeMapper &get_mapper() const noexcept { return _store.get_mapper(); }
 
@@ -13,7 +13,10 @@ MultiValueMapping<ElemT,RefT>::MultiValueMapping(const vespalib::datastore::Arra
                                                   const vespalib::GrowStrategy &gs,
                                                   std::shared_ptr<vespalib::alloc::MemoryAllocator> memory_allocator)
   : MultiValueMappingBase(gs, ArrayStore::getGenerationHolderLocation(_store), memory_allocator),
-    _store(storeCfg, std::move(memory_allocator), ArrayStoreTypeMapper(storeCfg.max_type_id(), array_store_grow_factor, max_buffer_size))
+    _store(storeCfg, std::move(memory_allocator), ArrayStoreTypeMapper(storeCfg.max_type_id(), array_store_grow_factor, max_buffer_size)),
+    _compaction_context(),
+    _compaction_lid(0),
+    _compaction_slice_time_budget(default_compaction_slice_time_budget)
 {
 }
 
@@ -45,12 +48,65 @@ template <typename ElemT, typename RefT>
 void
 MultiValueMapping<ElemT,RefT>::compact_worst(const CompactionStrategy& compaction_strategy)
 {
+    finish_compaction();
     vespalib::datastore::ICompactionContext::UP compactionContext(_store.compact_worst(compaction_strategy));
     if (compactionContext) {
         compactionContext->compact(std::span<AtomicEntryRef>(&_indices[0], _indices.size()));
     }
 }
 
+template <typename ElemT, typename RefT>
+bool
+MultiValueMapping<ElemT,RefT>::consider_compact(const CompactionStrategy& compaction_strategy)
+{
+    if (!_compaction_context) {
+        if (!_store.consider_compact()) {
+            return false;
+        }
+        _compaction_context = _store.compact_worst(compaction_strategy);
+        _compaction_lid = 0;
+        if (!_compaction_context) {
+            return true;
+        }
+    }
+    compact_slice();
+    return true;
+}
+
+template <typename ElemT, typename RefT>
+void
+MultiValueMapping<ElemT,RefT>::compact_slice()
+{
+    // New and updated values are never stored in the buffers being compacted, thus
+    // only lids not yet handled can refer to them.
+    vespalib::Timer timer;
+    do {
+        uint32_t lid_limit = _indices.size();
+        uint32_t begin = std::min(_compaction_lid, lid_limit);
+        uint32_t end = begin + std::min(compaction_chunk_lids, lid_limit - begin);
+        if (begin < end) {
+            _compaction_context->compact(std::span<AtomicEntryRef>(&_indices[begin], end - begin));
+        }
+        _compaction_lid = end;
+    } while (_compaction_lid < _indices.size() && timer.elapsed() < _compaction_slice_time_budget);
+    if (_compaction_lid >= _indices.size()) {
+        _compaction_context.reset();
+    }
+}
+
+template <typename ElemT, typename RefT>
+void
+MultiValueMapping<ElemT,RefT>::finish_compaction()
+{
+    if (_compaction_context) {
+        uint32_t lid_limit = _indices.size();
+        if (_compaction_lid < lid_limit) {
+            _compaction_context->compact(std::span<AtomicEntryRef>(&_indices[_compaction_lid], lid_limit - _compaction_lid));
+        }
+        _compaction_context.reset();
+    }
+}
+
 template <typename ElemT, typename RefT>
 vespalib::MemoryUsage
 MultiValueMapping<ElemT,RefT>::getArrayStoreMemoryUsage() const
@@ -56,7 +56,7 @@ MultiValueNumericEnumAttribute<B, M>::loadAllAtOnce(AttributeReader & attrReader
 
 template <typename B, typename M>
 bool
-MultiValueNumericEnumAttribute<B, M>::onLoadEnumerated(ReaderBase &attrReader)
+MultiValueNumericEnumAttribute<B, M>::onLoadEnumerated(ReaderBase &attrReader, vespalib::Executor *executor)
 {
     auto udatBuffer = attribute::LoadUtils::loadUDAT(*this);
 
@@ -74,6 +74,7 @@ MultiValueNumericEnumAttribute<B, M>::onLoadEnumerated(ReaderBase &attrReader)
 
     if (this->hasPostings()) {
         auto loader = this->getEnumStore().make_enumerated_postings_loader();
+        loader.set_sort_executor(executor);
         loader.load_unique_values(udatBuffer->buffer(), udatBuffer->size());
         loader.build_enum_value_remapping();
         this->load_enumerated_data(attrReader, loader, numValues);
@@ -93,7 +94,7 @@ MultiValueNumericEnumAttribute<B, M>::onLoadEnumerated(ReaderBase &attrReader)
 
 template <typename B, typename M>
 bool
-MultiValueNumericEnumAttribute<B, M>::onLoad(vespalib::Executor *)
+MultiValueNumericEnumAttribute<B, M>::onLoad(vespalib::Executor *executor)
 {
     AttributeReader attrReader(*this);
     bool ok(attrReader.getHasLoadData());
@@ -109,7 +110,7 @@ MultiValueNumericEnumAttribute<B, M>::onLoad(vespalib::Executor *)
     this->setCreateSerialNum(attrReader.getCreateSerialNum());
 
     if (attrReader.getEnumerated()) {
-        return onLoadEnumerated(attrReader);
+        return onLoadEnumerated(attrReader, executor);
     }
     
     size_t numDocs = attrReader.getNumIdx() - 1;
@@ -197,7 +197,7 @@ StringAttribute::apply(DocId, const ArithmeticValueUpdate & )
 }
 
 bool
-StringAttribute::onLoadEnumerated(ReaderBase &attrReader)
+StringAttribute::onLoadEnumerated(ReaderBase &attrReader, vespalib::Executor *executor)
 {
     auto udatBuffer = attribute::LoadUtils::loadUDAT(*this);
 
@@ -222,6 +222,7 @@ StringAttribute::onLoadEnumerated(ReaderBase &attrReader)
 
     if (hasPostings()) {
         auto loader = this->getEnumStoreBase()->make_enumerated_postings_loader();
+        loader.set_sort_executor(executor);
         loader.load_unique_values(udatBuffer->buffer(), udatBuffer->size());
         loader.build_enum_value_remapping();
         load_enumerated_data(attrReader, loader, numValues);
@@ -239,7 +240,7 @@ StringAttribute::onLoadEnumerated(ReaderBase &attrReader)
 }
 
 bool
-StringAttribute::onLoad(vespalib::Executor *)
+StringAttribute::onLoad(vespalib::Executor *executor)
 {
     ReaderBase attrReader(*this);
     bool ok(attrReader.getHasLoadData());
@@ -255,7 +256,7 @@ StringAttribute::onLoad(vespalib::Executor *)
     setCreateSerialNum(attrReader.getCreateSerialNum());
 
     assert(attrReader.getEnumerated());
-    return onLoadEnumerated(attrReader);
+    return onLoadEnumerated(attrReader, executor);
 }
 
 bool
@@ -7,6 +7,7 @@
 #include <vespa/searchlib/attribute/make_sort_blob_writer.h>
 #include <vespa/vespalib/util/array.h>
 #include <vespa/vespalib/util/issue.h>
+#include <algorithm>
 
 using vespalib::Issue;
 
@@ -16,6 +17,8 @@ LOG_SETUP(".search.attribute.sortresults");
 using search::RankedHit;
 using search::common::SortSpec;
 using search::common::FieldSortSpec;
+using search::common::sortspec::MissingPolicy;
+using search::attribute::BasicType;
 using search::attribute::IAttributeContext;
 using search::attribute::IAttributeVector;
 using search::attribute::make_sort_blob_writer;
@@ -55,6 +58,53 @@ insertion_sort(RankedHit a[], uint32_t n) {
     }
 }
 
+/**
+ * Moves the hits that may end up among the 'topn' first after sorting to
+ * the front of the array and returns how many they are. The sort key of a
+ * hit is the value of the primary sort attribute, converted the same way as
+ * in the sort blob, so hits compare equal here only if their sort blobs have
+ * the same prefix. Hits tied with the last candidate are all kept, as the
+ * remaining sort levels decide their order.
+ */
+template <typename C, typename GetValue>
+uint32_t
+select_top_candidates(RankedHit a[], uint32_t n, uint32_t topn, GetValue get_value)
+{
+    using Key = typename C::UIntType;
+    std::vector<Key, allocator_large<Key>> keys(n);
+    std::vector<Key> heap; // max-heap of the 'topn' smallest keys seen so far
+    heap.reserve(topn);
+    for (uint32_t i(0); i < n; ++i) {
+        Key key = C::convert(get_value(a[i].getDocId()));
+        keys[i] = key;
+        if (heap.size() < topn) {
+            heap.push_back(key);
+            std::push_heap(heap.begin(), heap.end());
+        } else if (key < heap.front()) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = key;
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+    const Key limit = heap.front();
+    uint32_t numCandidates(0);
+    for (uint32_t i(0); i < n; ++i) {
+        if (keys[i] <= limit) {
+            std::swap(a[i], a[numCandidates++]);
+        }
+    }
+    return numCandidates;
+}
+
+template <typename T, typename GetValue>
+uint32_t
+select_top_candidates(bool ascending, RankedHit a[], uint32_t n, uint32_t topn, GetValue get_value)
+{
+    return ascending
+        ? select_top_candidates<convertForSort<T, true>>(a, n, topn, get_value)
+        : select_top_candidates<convertForSort<T, false>>(a, n, topn, get_value);
+}
+
 }
 
 template<int SHIFT>
@@ -165,10 +215,12 @@ FastS_DefaultResultSorter FastS_DefaultResultSorter::_instance;
 //-----------------------------------------------------------------------------
 
 FastS_SortSpec::VectorRef::VectorRef(uint32_t type, const search::attribute::IAttributeVector* vector,
-                                     std::unique_ptr<search::attribute::ISortBlobWriter> writer) noexcept
+                                     std::unique_ptr<search::attribute::ISortBlobWriter> writer,
+                                     MissingPolicy missing_policy) noexcept
     : _type(type),
       _vector(vector),
-      _writer(std::move(writer))
+      _writer(std::move(writer)),
+      _missing_policy(missing_policy)
 {
 }
 
@@ -207,7 +259,7 @@ FastS_SortSpec::Add(IAttributeContext & vecMan, const FieldSortSpec & field_sort
     LOG(spam, "SortSpec: adding vector (%s)'%s'",
         (field_sort_spec.is_ascending()) ? "+" : "-", field_sort_spec._field.c_str());
 
-    _vectors.emplace_back(type, vector, std::move(sort_blob_writer));
+    _vectors.emplace_back(type, vector, std::move(sort_blob_writer), field_sort_spec._missing_policy);
 
     return true;
 }
@@ -257,6 +309,39 @@ FastS_SortSpec::initSortData(const RankedHit *hits, uint32_t n)
     }
 }
 
+uint32_t
+FastS_SortSpec::selectTopCandidates(RankedHit a[], uint32_t n, uint32_t topn) const
+{
+    // Only worth it when most of the hits can be discarded before writing sort blobs.
+    if (_vectors.empty() || (topn == 0) || (uint64_t(topn) * 2 >= n)) {
+        return n;
+    }
+    const VectorRef & primary = _vectors[0];
+    if ((primary._type > DESC_VECTOR) || (primary._vector == nullptr) ||
+        primary._vector->hasMultiValue() || (primary._missing_policy != MissingPolicy::DEFAULT))
+    {
+        return n;
+    }
+    const IAttributeVector & attr = *primary._vector;
+    bool ascending = primary.has_ascending_sort_order();
+    switch (attr.getBasicType()) {
+    case BasicType::INT8:
+    case BasicType::INT16:
+    case BasicType::INT32:
+    case BasicType::INT64:
+        return select_top_candidates<int64_t>(ascending, a, n, topn,
+                                              [&attr](uint32_t docId) { return attr.getInt(docId); });
+    case BasicType::FLOAT:
+        return select_top_candidates<float>(ascending, a, n, topn,
+                                            [&attr](uint32_t docId) { return float(attr.getFloat(docId)); });
+    case BasicType::DOUBLE:
+        return select_top_candidates<double>(ascending, a, n, topn,
+                                             [&attr](uint32_t docId) { return attr.getFloat(docId); });
+    default:
+        return n;
+    }
+}
+
 int
 FastS_SortSpec::initSortData(const VectorRef & vec, const RankedHit & hit, size_t offset) {
     long written(0);
@@ -449,12 +534,15 @@ public:
 void
 FastS_SortSpec::sortResults(RankedHit a[], uint32_t n, uint32_t topn)
 {
-    initSortData(a, n);
+    // Sort blobs are only written for the hits that can make it to the top.
+    // The others are left behind them in the array, in no particular order.
+    uint32_t numCandidates = selectTopCandidates(a, n, topn);
+    initSortData(a, numCandidates);
     {
         SortData * sortData = _sortDataArray.data();
         const uint8_t * binary = _binarySortData.data();
-        Array<uint32_t> radixScratchPad(n, Alloc::alloc(0, MMAP_LIMIT));
-        search::radix_sort(SortDataRadix(binary), StdSortDataCompare(binary), SortDataEof(), 1, sortData, n, radixScratchPad.data(), 0, 96, topn);
+        Array<uint32_t> radixScratchPad(numCandidates, Alloc::alloc(0, MMAP_LIMIT));
+        search::radix_sort(SortDataRadix(binary), StdSortDataCompare(binary), SortDataEof(), 1, sortData, numCandidates, radixScratchPad.data(), 0, 96, topn);
     }
     for (uint32_t i(0); i < _sortDataArray.size(); ++i) {
         a[i]._rankValue = _sortDataArray[i]._rankValue;
@@ -74,10 +74,12 @@ public:
     struct VectorRef
     {
         VectorRef(uint32_t type, const search::attribute::IAttributeVector * vector,
-                  std::unique_ptr<search::attribute::ISortBlobWriter> writer) noexcept;
+                  std::unique_ptr<search::attribute::ISortBlobWriter> writer,
+                  search::common::sortspec::MissingPolicy missing_policy = search::common::sortspec::MissingPolicy::DEFAULT) noexcept;
         uint32_t                 _type;
         const search::attribute::IAttributeVector *_vector;
         std::unique_ptr<search::attribute::ISortBlobWriter> _writer;
+        search::common::sortspec::MissingPolicy _missing_policy;
         bool has_ascending_sort_order() const {
             return _type == ASC_VECTOR || _type == ASC_RANK || _type == ASC_DOCID;
         }
@@ -107,6 +109,7 @@ private:
 
     bool Add(search::attribute::IAttributeContext & vecMan, const search::common::FieldSortSpec & field_sort_spec);
     void initSortData(const search::RankedHit *a, uint32_t n);
+    uint32_t selectTopCandidates(search::RankedHit a[], uint32_t n, uint32_t topn) const;
     int initSortData(const VectorRef & vec, const search::RankedHit & hit, size_t offset);
 
 public:
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
 
 namespace search::diskindex {
 
@@ -55,6 +56,42 @@ public:
         }
     }
 
+    /*
+     * Skip docid deltas (docid = prev docid + 1 + delta) while the docid
+     * stays below limit, handling 8 single byte deltas at a time using
+     * SWAR (SIMD within a register) arithmetic. Stops at the first group
+     * containing a multi byte delta or crossing limit. Returns the
+     * number of skipped deltas. The caller must ensure that 8 bytes can
+     * be read from the current position, e.g. due to padding after the
+     * posting list.
+     */
+    uint32_t skip_small_docid_deltas(uint32_t& doc_id, uint32_t limit) noexcept {
+        constexpr uint64_t marks = 0x8080808080808080ul;
+        constexpr uint64_t low_bytes = 0x00ff00ff00ff00fful;
+        constexpr uint64_t sum_lanes = 0x0001000100010001ul;
+        const uint8_t *cur = _cur;
+        uint64_t pos = doc_id;
+        uint64_t words;
+        while (true) {
+            memcpy(&words, cur, sizeof(words));
+            if ((words & marks) != 0) {
+                break;
+            }
+            // Add bytes pairwise into 16-bit lanes, then sum the lanes.
+            uint64_t pairs = (words & low_bytes) + ((words >> 8) & low_bytes);
+            uint64_t next_pos = pos + 8 + ((pairs * sum_lanes) >> 48);
+            if (next_pos >= limit) {
+                break;
+            }
+            pos = next_pos;
+            cur += 8;
+        }
+        uint32_t skipped = (cur - _cur);
+        _cur = cur;
+        doc_id = pos;
+        return skipped;
+    }
+
     uint32_t decode32() noexcept {
         const uint8_t *cur = _cur;
         if (cur[0] < mark) [[likely]] {
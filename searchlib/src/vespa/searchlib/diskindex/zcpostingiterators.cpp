@@ -579,6 +579,9 @@ ZcPostingIteratorBase::doSeek(uint32_t docId)
         assert(oDocId <= _l3._skipDocId);
         assert(oDocId <= _l4._skipDocId);
 #endif
+        if (!_decode_interleaved_features) {
+            incNeedUnpack(zc_decoder.skip_small_docid_deltas(oDocId, docId));
+        }
         oDocId += (1 + zc_decoder.decode32());
 #if DEBUG_ZCPOSTING_PRINTF
         printf("Decode docId=%d\n",
@@ -636,6 +636,9 @@ const double DegradationMaxFilterCoverage::DEFAULT_VALUE(0.2);
 const std::string DegradationPostFilterMultiplier::NAME("vespa.matchphase.degradation.postfiltermultiplier");
 const double DegradationPostFilterMultiplier::DEFAULT_VALUE(1.0);
 
+const std::string DegradationFromSort::NAME("vespa.matchphase.degradation.fromsort");
+const bool DegradationFromSort::DEFAULT_VALUE(false);
+
 const std::string DiversityAttribute::NAME("vespa.matchphase.diversity.attribute");
 const std::string DiversityAttribute::DEFAULT_VALUE("");
 
@@ -684,6 +687,12 @@ DegradationPostFilterMultiplier::lookup(const Properties &props, double defaultV
     return lookupDouble(props, NAME, defaultValue);
 }
 
+bool
+DegradationFromSort::lookup(const Properties &props, bool defaultValue)
+{
+    return lookupBool(props, NAME, defaultValue);
+}
+
 std::string
 DiversityAttribute::lookup(const Properties &props, const std::string & defaultValue)
 {
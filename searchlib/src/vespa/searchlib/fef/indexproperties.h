@@ -537,6 +537,19 @@ namespace matchphase {
         static double lookup(const Properties &props, double defaultValue);
     };
 
+    /**
+     * Property for using the primary sort attribute of a sorted query for
+     * graceful degradation during match phase, when no degradation attribute
+     * is given. The number of wanted hits is then offset + hits of the query,
+     * and the attribute must be a single value numeric attribute with fast-search.
+     **/
+    struct DegradationFromSort {
+        static const std::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool lookup(const Properties &props) { return lookup(props, DEFAULT_VALUE); }
+        static bool lookup(const Properties &props, bool defaultValue);
+    };
+
     /**
      * The name of the attribute used to ensure result diversity
      * during match phase limiting. If this property is "" (empty
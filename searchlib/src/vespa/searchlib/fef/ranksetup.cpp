@@ -64,6 +64,7 @@ RankSetup::RankSetup(const BlueprintFactory &factory, const IIndexEnvironment &i
       _compiled(false),
       _compileError(false),
       _degradationAscendingOrder(false),
+      _degradationFromSort(false),
       _diversityAttribute(),
       _diversityMinGroups(1),
       _diversityCutoffFactor(10.0),
@@ -118,6 +119,7 @@ RankSetup::configure()
     setDegradationAttribute(matchphase::DegradationAttribute::lookup(_indexEnv.getProperties()));
     setDegradationOrderAscending(matchphase::DegradationAscendingOrder::lookup(_indexEnv.getProperties()));
     setDegradationMaxHits(matchphase::DegradationMaxHits::lookup(_indexEnv.getProperties()));
+    setDegradationFromSort(matchphase::DegradationFromSort::lookup(_indexEnv.getProperties()));
     setDegradationMaxFilterCoverage(matchphase::DegradationMaxFilterCoverage::lookup(_indexEnv.getProperties()));
     setDegradationSamplePercentage(matchphase::DegradationSamplePercentage::lookup(_indexEnv.getProperties()));
     setDegradationPostFilterMultiplier(matchphase::DegradationPostFilterMultiplier::lookup(_indexEnv.getProperties()));
@@ -73,6 +73,7 @@ private:
     bool                     _compiled;
     bool                     _compileError;
     bool                     _degradationAscendingOrder;
+    bool                     _degradationFromSort;
     std::string         _diversityAttribute;
     uint32_t                 _diversityMinGroups;
     double                   _diversityCutoffFactor;
@@ -235,6 +236,11 @@ public:
         return _degradationMaxHits;
     }
 
+    /** check whether the primary sort attribute of sorted queries should be used for graceful degradation in match phase */
+    bool isDegradationFromSort() const {
+        return _degradationFromSort;
+    }
+
     double getDegradationMaxFilterCoverage() const { return _degradationMaxFilterCoverage; }
     /** get number of hits to collect during graceful degradation in match phase */
     double getDegradationSamplePercentage() const {
@@ -277,6 +283,11 @@ public:
         _degradationMaxHits = maxHits;
     }
 
+    /** set whether the primary sort attribute of sorted queries should be used for graceful degradation in match phase */
+    void setDegradationFromSort(bool fromSort) {
+        _degradationFromSort = fromSort;
+    }
+
     void setDegradationMaxFilterCoverage(double degradationMaxFilterCoverage) {
         _degradationMaxFilterCoverage = degradationMaxFilterCoverage;
     }
@@ -29,11 +29,12 @@ DocumentInverter::DocumentInverter(DocumentInverterContext& context)
 {
     auto& schema = context.get_schema();
     auto& field_indexes = context.get_field_indexes();
+    auto* sort_threads = context.get_sort_threads();
     for (uint32_t fieldId = 0; fieldId < schema.getNumIndexFields(); ++fieldId) {
         auto &remover(field_indexes.get_remover(fieldId));
         auto &inserter(field_indexes.get_inserter(fieldId));
         auto &calculator(field_indexes.get_calculator(fieldId));
-        _inverters.push_back(std::make_unique<FieldInverter>(schema, fieldId, remover, inserter, calculator));
+        _inverters.push_back(std::make_unique<FieldInverter>(schema, fieldId, remover, inserter, calculator, sort_threads));
     }
     auto& schema_index_fields = context.get_schema_index_fields();
     for (auto &urlField : schema_index_fields._uriFields) {
@@ -126,14 +126,16 @@ void connect_contexts(std::vector<InvertContext>& invert_contexts,
 DocumentInverterContext::DocumentInverterContext(const index::Schema& schema,
                                                  ISequencedTaskExecutor &invert_threads,
                                                  ISequencedTaskExecutor &push_threads,
-                                                 IFieldIndexCollection& field_indexes)
+                                                 IFieldIndexCollection& field_indexes,
+                                                 vespalib::SimpleThreadBundle::Pool* sort_threads)
     : _schema(schema),
       _schema_index_fields(),
       _invert_threads(invert_threads),
       _push_threads(push_threads),
       _field_indexes(field_indexes),
       _invert_contexts(),
-      _push_contexts()
+      _push_contexts(),
+      _sort_threads(sort_threads)
 {
     _schema_index_fields.setup(schema);
     setup_contexts();
@@ -5,7 +5,7 @@
 #include <vespa/searchlib/index/schema_index_fields.h>
 #include "invert_context.h"
 #include "push_context.h"
-#include <memory>
+#include <vespa/vespalib/util/simple_thread_bundle.h>
 #include <vector>
 
 namespace search::memoryindex {
@@ -24,12 +24,14 @@ class DocumentInverterContext {
     IFieldIndexCollection&            _field_indexes;
     std::vector<InvertContext>        _invert_contexts;
     std::vector<PushContext>          _push_contexts;
+    vespalib::SimpleThreadBundle::Pool* _sort_threads;
     void setup_contexts();
 public:
     DocumentInverterContext(const index::Schema &schema,
                             vespalib::ISequencedTaskExecutor &invert_threads,
                             vespalib::ISequencedTaskExecutor &push_threads,
-                            IFieldIndexCollection& field_indexes);
+                            IFieldIndexCollection& field_indexes,
+                            vespalib::SimpleThreadBundle::Pool* sort_threads = nullptr);
     ~DocumentInverterContext();
     const index::Schema& get_schema() const noexcept { return _schema; }
     const index::SchemaIndexFields& get_schema_index_fields() const noexcept { return _schema_index_fields; }
@@ -38,6 +40,8 @@ public:
     IFieldIndexCollection& get_field_indexes() noexcept { return _field_indexes; }
     const std::vector<InvertContext>& get_invert_contexts() const noexcept { return _invert_contexts; }
     const std::vector<PushContext>& get_push_contexts() const noexcept { return _push_contexts; }
+    // Pool of thread bundles used to sort large batches of inverted positions, nullptr if not in use.
+    vespalib::SimpleThreadBundle::Pool* get_sort_threads() noexcept { return _sort_threads; }
 };
 
 }
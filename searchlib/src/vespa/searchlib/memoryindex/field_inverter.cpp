@@ -242,7 +242,8 @@ FieldInverter::processNormalDocWeightedSetTextField(const WeightedSetFieldValue
 FieldInverter::FieldInverter(const Schema &schema, uint32_t fieldId,
                              FieldIndexRemover &remover,
                              IOrderedFieldIndexInserter &inserter,
-                             index::FieldLengthCalculator &calculator)
+                             index::FieldLengthCalculator &calculator,
+                             vespalib::SimpleThreadBundle::Pool *sort_threads)
     : _fieldId(fieldId),
       _elem(0u),
       _wpos(0u),
@@ -261,7 +262,8 @@ FieldInverter::FieldInverter(const Schema &schema, uint32_t fieldId,
       _removeDocs(),
       _remover(remover),
       _inserter(inserter),
-      _calculator(calculator)
+      _calculator(calculator),
+      _sort_threads(sort_threads)
 {
 }
 
@@ -389,6 +391,73 @@ struct FullRadix {
     }
 };
 
+void
+sort_positions(FieldInverter::PosInfo *positions, size_t size)
+{
+    ShiftBasedRadixSorter<FieldInverter::PosInfo, FullRadix, std::less<FieldInverter::PosInfo>, 56, true>::
+        radix_sort(FullRadix(), std::less<FieldInverter::PosInfo>(), positions, size, 16);
+}
+
+class SortShardTask : public vespalib::Runnable {
+    FieldInverter::PosInfo *_positions;
+    size_t                  _size;
+public:
+    SortShardTask(FieldInverter::PosInfo *positions, size_t size) noexcept
+        : _positions(positions),
+          _size(size)
+    {
+    }
+    void run() override { sort_positions(_positions, _size); }
+};
+
+}
+
+void
+FieldInverter::sortPositions()
+{
+    size_t num_positions = _positions.size();
+    vespalib::SimpleThreadBundle::UP bundle;
+    if (_sort_threads != nullptr && num_positions >= 2 * min_positions_per_sort_shard) {
+        // The pool is shared by all memory indexes; sort on this thread only when all bundles are busy.
+        bundle = _sort_threads->try_obtain();
+    }
+    if (!bundle) {
+        sort_positions(&_positions[0], num_positions);
+        return;
+    }
+    uint32_t num_shards = std::min(bundle->size(), num_positions / min_positions_per_sort_shard);
+    // Assign consecutive word number ranges with roughly the same number of positions to each shard.
+    uint32_t num_words = _wordRefs.size() - 1;
+    UInt32Vector word_shard(num_words + 1, 0u);
+    for (const auto &p : _positions) {
+        ++word_shard[p._wordNum];
+    }
+    std::vector<size_t> shard_start(num_shards + 1, num_positions);
+    shard_start[0] = 0;
+    uint32_t shard = 0;
+    size_t assigned = 0;
+    for (uint32_t wordNum = 1; wordNum <= num_words; ++wordNum) {
+        if (shard + 1 < num_shards && assigned >= (shard + 1) * num_positions / num_shards) {
+            ++shard;
+            shard_start[shard] = assigned;
+        }
+        assigned += word_shard[wordNum];
+        word_shard[wordNum] = shard;
+    }
+    // Scatter positions to their shards, then sort each shard on a separate thread.
+    std::vector<size_t> fill(shard_start.begin(), shard_start.end() - 1);
+    PosInfoVec sharded(num_positions);
+    for (const auto &p : _positions) {
+        sharded[fill[word_shard[p._wordNum]]++] = p;
+    }
+    _positions.swap(sharded);
+    std::vector<SortShardTask> tasks;
+    tasks.reserve(num_shards);
+    for (shard = 0; shard < num_shards; ++shard) {
+        tasks.emplace_back(&_positions[shard_start[shard]], shard_start[shard + 1] - shard_start[shard]);
+    }
+    bundle->run(tasks);
+    _sort_threads->release(std::move(bundle));
 }
 
 void
@@ -413,8 +482,7 @@ FieldInverter::push_documents_internal()
     sortWords();
 
     // Sort for terms.
-    ShiftBasedRadixSorter<PosInfo, FullRadix, std::less<PosInfo>, 56, true>::
-        radix_sort(FullRadix(), std::less<PosInfo>(), &_positions[0], _positions.size(), 16);
+    sortPositions();
 
     constexpr uint32_t NO_ELEMENT_ID = std::numeric_limits<uint32_t>::max();
     constexpr uint32_t NO_WORD_POS = std::numeric_limits<uint32_t>::max();
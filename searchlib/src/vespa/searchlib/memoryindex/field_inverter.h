@@ -8,6 +8,7 @@
 #include <vespa/searchlib/util/token_extractor.h>
 #include <vespa/vespalib/stllike/allocator.h>
 #include <vespa/vespalib/stllike/hash_map.h>
+#include <vespa/vespalib/util/simple_thread_bundle.h>
 #include <limits>
 
 namespace search::index {
@@ -97,6 +98,9 @@ public:
     // Max length of an indexed word. Longer words are dropped.
     static constexpr size_t max_word_len = 1_Mi;
 
+    // Min number of positions sorted by each thread when sorting positions in parallel.
+    static constexpr size_t min_positions_per_sort_shard = 64_Ki;
+
 private:
     using WordBuffer = std::vector<char, vespalib::allocator_large<char>>;
 
@@ -192,6 +196,7 @@ private:
     FieldIndexRemover                &_remover;
     IOrderedFieldIndexInserter       &_inserter;
     index::FieldLengthCalculator     &_calculator;
+    vespalib::SimpleThreadBundle::Pool *_sort_threads;
 
     void invertNormalDocTextField(const document::FieldValue &val, const document::Document& doc);
 
@@ -267,6 +272,13 @@ private:
      */
     void sortWords();
 
+    /**
+     * Sort positions by {word number, docId, ...}. Large batches are split into shards covering
+     * disjoint word number ranges that are sorted in parallel, making the concatenation of the
+     * sorted shards globally sorted.
+     */
+    void sortPositions();
+
     void moveNotAbortedDocs(uint32_t &dstIdx, uint32_t srcIdx, uint32_t nextTrimIdx);
 
     void trimAbortedDocs();
@@ -279,11 +291,13 @@ private:
 public:
     /**
      * Create a new field inverter for the given fieldId, using the given schema.
+     * Thread bundles from the optional sort_threads pool are used to sort large batches of positions.
      */
     FieldInverter(const index::Schema &schema, uint32_t fieldId,
                   FieldIndexRemover &remover,
                   IOrderedFieldIndexInserter &inserter,
-                  index::FieldLengthCalculator &calculator);
+                  index::FieldLengthCalculator &calculator,
+                  vespalib::SimpleThreadBundle::Pool *sort_threads = nullptr);
     FieldInverter(const FieldInverter &) = delete;
     FieldInverter(const FieldInverter &&) = delete;
     FieldInverter &operator=(const FieldInverter &) = delete;
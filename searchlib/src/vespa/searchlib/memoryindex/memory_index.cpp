@@ -57,12 +57,13 @@ namespace search::memoryindex {
 MemoryIndex::MemoryIndex(const Schema& schema,
                          const IFieldLengthInspector& inspector,
                          ISequencedTaskExecutor& invertThreads,
-                         ISequencedTaskExecutor& pushThreads)
+                         ISequencedTaskExecutor& pushThreads,
+                         vespalib::SimpleThreadBundle::Pool* sortThreads)
     : _schema(schema),
       _invertThreads(invertThreads),
       _pushThreads(pushThreads),
       _fieldIndexes(std::make_unique<FieldIndexCollection>(_schema, inspector)),
-      _inverter_context(std::make_unique<DocumentInverterContext>(_schema, _invertThreads, _pushThreads, *_fieldIndexes)),
+      _inverter_context(std::make_unique<DocumentInverterContext>(_schema, _invertThreads, _pushThreads, *_fieldIndexes, sortThreads)),
       _inverters(std::make_unique<DocumentInverterCollection>(*_inverter_context, 3)),
       _frozen(false),
       _maxDocId(0), // docId 0 is reserved
@@ -9,6 +9,7 @@
 #include <vespa/searchlib/util/index_stats.h>
 #include <vespa/vespalib/stllike/hash_set.h>
 #include <vespa/vespalib/util/memoryusage.h>
+#include <vespa/vespalib/util/simple_thread_bundle.h>
 #include <atomic>
 #include <mutex>
 
@@ -90,11 +91,14 @@ public:
      * @param invertThreads the executor with threads for doing document inverting.
      * @param pushThreads   the executor with threads for doing pushing of changes (inverted documents)
      *                      to corresponding field indexes.
+     * @param sortThreads   optional pool of thread bundles used to sort large batches of inverted
+     *                      positions in parallel. Must outlive the memory index.
      */
     MemoryIndex(const index::Schema& schema,
                 const index::IFieldLengthInspector& inspector,
                 ISequencedTaskExecutor& invertThreads,
-                ISequencedTaskExecutor& pushThreads);
+                ISequencedTaskExecutor& pushThreads,
+                vespalib::SimpleThreadBundle::Pool* sortThreads = nullptr);
 
     MemoryIndex(const MemoryIndex &) = delete;
     MemoryIndex(MemoryIndex &&) = delete;
@@ -20,6 +20,7 @@ protected:
     void clearUnpacked()           { _needUnpack = 1; }
     uint32_t getNeedUnpack() const { return _needUnpack; }
     void incNeedUnpack()           { ++_needUnpack; }
+    void incNeedUnpack(uint32_t count) { _needUnpack += count; }
 public:
     RankedSearchIteratorBase(fef::TermFieldMatchDataArray matchData);
     ~RankedSearchIteratorBase() override;
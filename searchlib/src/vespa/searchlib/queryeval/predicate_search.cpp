@@ -140,7 +140,7 @@ PredicateSearch::PredicateSearch(const uint8_t * minFeatureVector,
       _sorted_indexes(_posting_lists.size()),
       _sorted_indexes_merge_buffer(_posting_lists.size()),
       _doc_ids(_posting_lists.size()),
-      _intervals(_posting_lists.size()),
+      _interval_entries(),
       _subqueries(_posting_lists.size()),
       _subquery_markers(new uint64_t[max_interval_range+1]),
       _visited(new bool[max_interval_range+1]),
@@ -239,22 +239,11 @@ addInterval(uint32_t interval, uint64_t subquery, uint64_t *subquery_markers,
     }
 }
 
-// One step of insertion sort: First element is moved to correct position.
-void
-restoreSortedOrder(size_t first, size_t last, vector<uint16_t> &indexes, const vector<uint32_t> &intervals) {
-    uint32_t interval_to_move = intervals[indexes[first]];
-    uint16_t index_to_move = indexes[first];
-    while (++first < last && interval_to_move > intervals[indexes[first]]) {
-        indexes[first - 1] = indexes[first];
-    }
-    indexes[first - 1] = index_to_move;
-}
-
 }  // namespace
 
 bool
 PredicateSearch::evaluateHit(uint32_t doc_id, uint32_t k) {
-    size_t candidates = sortIntervals(doc_id, k);
+    sortIntervals(doc_id, k);
 
     size_t interval_end = _interval_range_vector[doc_id];
     memset(_subquery_markers, 0, sizeof(uint64_t) * (interval_end + 1));
@@ -263,25 +252,23 @@ PredicateSearch::evaluateHit(uint32_t doc_id, uint32_t k) {
     _visited[0] = true;
 
     uint32_t highest_end_seen = 1;
-    for (size_t i = 0; i < candidates; ) {
-        size_t index = _sorted_indexes[i];
-        uint32_t last_end_seen = addInterval(_intervals[index], _subqueries[index],
+    for (uint64_t entry : _interval_entries) {
+        uint32_t last_end_seen = addInterval(entry >> 16, _subqueries[entry & 0xffff],
                                              _subquery_markers, _visited, highest_end_seen);
         if (last_end_seen == UINT32_MAX) {
             return false;
         }
         highest_end_seen = std::max(last_end_seen, highest_end_seen);
-        if (_posting_lists[index]->nextInterval()) {
-            _intervals[index] = _posting_lists[index]->getInterval();
-            restoreSortedOrder(i, candidates, _sorted_indexes, _intervals);
-        } else {
-            ++i;
-        }
     }
     return _subquery_markers[interval_end] != 0;
 }
 
-size_t
+/*
+ * Collects the intervals of all posting lists positioned at doc_id into
+ * a single array sorted on interval. Intervals that are equal do not
+ * depend on each other, so their relative order does not matter.
+ */
+void
 PredicateSearch::sortIntervals(uint32_t doc_id, uint32_t k) {
     size_t candidates = k + 1;
     for (size_t i = candidates; i < _sorted_indexes.size(); ++i) {
@@ -291,11 +278,15 @@ PredicateSearch::sortIntervals(uint32_t doc_id, uint32_t k) {
             break;
         }
     }
+    _interval_entries.clear();
     for (size_t i = 0; i < candidates; i++) {
-        _intervals[_sorted_indexes[i]] = _posting_lists[_sorted_indexes[i]]->getInterval();
+        uint16_t index = _sorted_indexes[i];
+        auto &posting_list = *_posting_lists[index];
+        do {
+            _interval_entries.push_back((uint64_t(posting_list.getInterval()) << 16) | index);
+        } while (posting_list.nextInterval());
     }
-    sort_indexes(&_sorted_indexes[0], candidates, &_intervals[0]);
-    return candidates;
+    std::sort(_interval_entries.begin(), _interval_entries.end());
 }
 
 void
@@ -36,7 +36,7 @@ class PredicateSearch : public SearchIterator {
     std::vector<uint16_t> _sorted_indexes;
     std::vector<uint16_t> _sorted_indexes_merge_buffer;
     std::vector<uint32_t> _doc_ids;
-    std::vector<uint32_t> _intervals;
+    std::vector<uint64_t> _interval_entries; // (interval << 16 | posting list index) for the evaluated document
     std::vector<uint64_t> _subqueries;
     uint64_t *_subquery_markers;
     bool * _visited;
@@ -47,7 +47,7 @@ class PredicateSearch : public SearchIterator {
     VESPA_DLL_LOCAL bool advanceOneTo(uint32_t doc_id, size_t index);
     VESPA_DLL_LOCAL void advanceAllTo(uint32_t doc_id);
     VESPA_DLL_LOCAL bool evaluateHit(uint32_t doc_id, uint32_t k);
-    VESPA_DLL_LOCAL size_t sortIntervals(uint32_t doc_id, uint32_t k);
+    VESPA_DLL_LOCAL void sortIntervals(uint32_t doc_id, uint32_t k);
     VESPA_DLL_LOCAL void skipMinFeature(uint32_t doc_id) __attribute__((noinline));
 
 public:
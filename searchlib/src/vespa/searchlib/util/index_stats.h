@@ -18,6 +18,8 @@ private:
     size_t _docsInMemory;
     size_t _sizeOnDisk; // in bytes
     size_t _fusion_size_on_disk; // in bytes
+    uint64_t _flush_bytes_written; // in bytes, written by flush of memory indexes
+    uint64_t _fusion_bytes_written; // in bytes, written by fusion of disk indexes
     uint32_t _disk_indexes;
     uint32_t _memory_indexes;
     std::map<std::string, FieldIndexStats> _field_stats;
@@ -45,6 +47,16 @@ public:
         return *this;
     }
     size_t fusion_size_on_disk() const { return _fusion_size_on_disk; }
+    IndexStats& flush_bytes_written(uint64_t value) noexcept {
+        _flush_bytes_written = value;
+        return *this;
+    }
+    uint64_t flush_bytes_written() const noexcept { return _flush_bytes_written; }
+    IndexStats& fusion_bytes_written(uint64_t value) noexcept {
+        _fusion_bytes_written = value;
+        return *this;
+    }
+    uint64_t fusion_bytes_written() const noexcept { return _fusion_bytes_written; }
     IndexStats& disk_indexes(uint32_t value) noexcept
     {
         _disk_indexes = value;
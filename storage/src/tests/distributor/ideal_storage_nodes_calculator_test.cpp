@@ -0,0 +1,56 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/storage/distributor/ideal_storage_nodes_calculator.h>
+#include <vespa/vdslib/distribution/distribution.h>
+#include <vespa/vdslib/state/clusterstate.h>
+#include <vespa/vespalib/gtest/gtest.h>
+
+using document::BucketId;
+using storage::lib::ClusterState;
+using storage::lib::Distribution;
+
+namespace storage::distributor {
+
+struct IdealStorageNodesCalculatorTest : ::testing::Test {
+    ClusterState state;
+    Distribution distribution;
+
+    IdealStorageNodesCalculatorTest()
+        : state("distributor:4 storage:6 .2.s:m bits:8"),
+          distribution(Distribution::getDefaultDistributionConfig(3, 6))
+    {
+    }
+    ~IdealStorageNodesCalculatorTest() override;
+
+    std::vector<uint16_t> expected_nodes(BucketId bucket) const {
+        return distribution.getIdealStorageNodes(state, bucket, "ui");
+    }
+};
+
+IdealStorageNodesCalculatorTest::~IdealStorageNodesCalculatorTest() = default;
+
+TEST_F(IdealStorageNodesCalculatorTest, ideal_nodes_match_distribution_for_sub_buckets_and_deep_splits)
+{
+    IdealStorageNodesCalculator calc(state, distribution, "ui");
+    for (uint32_t superbucket = 0; superbucket < 256; ++superbucket) {
+        // Visit all sub-buckets of a superbucket in sequence, like a bucket DB iteration does.
+        for (uint32_t used_bits : {8u, 16u, 24u, 33u, 34u, 40u, 58u}) {
+            for (uint64_t sub : {0u, 1u, 7u}) {
+                BucketId bucket(used_bits, superbucket | (sub << 8) | (sub << 33));
+                EXPECT_EQ(calc.ideal_nodes(bucket), expected_nodes(bucket)) << bucket;
+            }
+        }
+    }
+}
+
+TEST_F(IdealStorageNodesCalculatorTest, failed_calculation_does_not_poison_cache)
+{
+    IdealStorageNodesCalculator calc(state, distribution, "ui");
+    BucketId bucket(16, 0x1234);
+    EXPECT_EQ(calc.ideal_nodes(bucket), expected_nodes(bucket));
+    EXPECT_THROW((void)calc.ideal_nodes(BucketId(4, 0x4)), lib::TooFewBucketBitsInUseException);
+    EXPECT_EQ(calc.ideal_nodes(bucket), expected_nodes(bucket));
+    EXPECT_EQ(calc.ideal_nodes(BucketId(20, 0x51234)), expected_nodes(BucketId(20, 0x51234)));
+}
+
+}
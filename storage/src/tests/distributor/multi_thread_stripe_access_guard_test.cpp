@@ -7,8 +7,12 @@
 #include <vespa/vdslib/distribution/distribution.h>
 #include <vespa/vdslib/state/clusterstate.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <latch>
+#include <stdexcept>
+#include <thread>
 
 using namespace ::testing;
+using namespace std::chrono_literals;
 using RawIdVector = std::vector<uint64_t>;
 
 constexpr uint8_t MUB = storage::spi::BucketLimits::MinUsedBits;
@@ -19,8 +23,25 @@ struct AggregationTestingMockTickableStripe : MockTickableStripe {
     PotentialDataLossReport report;
     std::vector<dbtransition::Entry> entries;
     StripeAccessGuard::PendingOperationStats pending_stats{0, 0};
+    std::latch* all_stripes_invoked = nullptr;
+    bool observed_concurrent_invocation = false;
+    bool fail_remove = false;
+    uint32_t remove_invocations = 0;
 
     PotentialDataLossReport remove_superfluous_buckets(document::BucketSpace, const lib::ClusterState&, bool) override {
+        ++remove_invocations;
+        if (fail_remove) {
+            throw std::runtime_error("remove failed");
+        }
+        if (all_stripes_invoked) {
+            // Only completes if all stripes are processed at the same time.
+            all_stripes_invoked->count_down();
+            const auto deadline = std::chrono::steady_clock::now() + 60s;
+            while (!all_stripes_invoked->try_wait() && (std::chrono::steady_clock::now() < deadline)) {
+                std::this_thread::sleep_for(1ms);
+            }
+            observed_concurrent_invocation = all_stripes_invoked->try_wait();
+        }
         return report;
     }
 
@@ -104,6 +125,39 @@ TEST_F(MultiThreadedStripeAccessGuardTest, remove_superfluous_buckets_aggregates
     EXPECT_EQ(report.documents, 680);
 }
 
+TEST_F(MultiThreadedStripeAccessGuardTest, remove_superfluous_buckets_processes_stripes_in_parallel) {
+    std::latch all_stripes_invoked(4);
+    for (auto* stripe : {&_stripe0, &_stripe1, &_stripe2, &_stripe3}) {
+        stripe->all_stripes_invoked = &all_stripes_invoked;
+    }
+    start_pool_with_stripes();
+
+    auto guard = _accessor.rendezvous_and_hold_all();
+    (void)guard->remove_superfluous_buckets(document::FixedBucketSpaces::default_space(), lib::ClusterState(), false);
+    for (auto* stripe : {&_stripe0, &_stripe1, &_stripe2, &_stripe3}) {
+        EXPECT_TRUE(stripe->observed_concurrent_invocation);
+    }
+}
+
+TEST_F(MultiThreadedStripeAccessGuardTest, exception_from_any_stripe_is_rethrown_after_all_stripes_are_done) {
+    start_pool_with_stripes();
+    for (auto* failing : {&_stripe0, &_stripe2}) {
+        failing->fail_remove = true;
+        auto guard = _accessor.rendezvous_and_hold_all();
+        EXPECT_THROW((void)guard->remove_superfluous_buckets(document::FixedBucketSpaces::default_space(),
+                                                             lib::ClusterState(), false),
+                     std::runtime_error);
+        failing->fail_remove = false;
+    }
+    for (auto* stripe : {&_stripe0, &_stripe1, &_stripe2, &_stripe3}) {
+        EXPECT_EQ(stripe->remove_invocations, 2u);
+    }
+    // Helper threads are still usable
+    auto guard = _accessor.rendezvous_and_hold_all();
+    (void)guard->remove_superfluous_buckets(document::FixedBucketSpaces::default_space(), lib::ClusterState(), false);
+    EXPECT_EQ(_stripe3.remove_invocations, 3u);
+}
+
 TEST_F(MultiThreadedStripeAccessGuardTest, pending_operation_stats_aggregates_stats_across_stripes) {
     using Stats = StripeAccessGuard::PendingOperationStats;
     _stripe0.pending_stats = Stats(20, 100);
@@ -18,6 +18,7 @@
 #include <vespa/storage/distributor/distributor_stripe.h>
 #include <vespa/storage/distributor/distributor_bucket_space.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
 #include <vespa/vespalib/text/stringtokenizer.h>
 #include <sstream>
 
@@ -842,6 +843,32 @@ TEST_F(TopLevelBucketDBUpdaterTest, node_down) {
 }
 
 
+TEST_F(TopLevelBucketDBUpdaterTest, DISABLED_benchmark_node_down_with_many_buckets) {
+    constexpr uint32_t n_buckets = 50'000'000;
+    constexpr uint16_t n_nodes = 40;
+    ASSERT_NO_FATAL_FAILURE(set_storage_nodes(n_nodes));
+    enable_distributor_cluster_state(vespalib::make_string("distributor:1 storage:%u", n_nodes));
+
+    for (uint32_t i = 0; i < n_buckets; ++i) {
+        document::BucketId bucket(32, i);
+        BucketDatabase::Entry entry(bucket);
+        entry->addNodeManual(BucketCopy(1, i % n_nodes, api::BucketInfo(10, 100, 1000)));
+        entry->addNodeManual(BucketCopy(1, (i + 1) % n_nodes, api::BucketInfo(10, 100, 1000)));
+        stripe_bucket_database(stripe_index_of_bucket(bucket)).update(entry);
+    }
+
+    vespalib::BenchmarkTimer timer(0.0);
+    timer.before();
+    set_cluster_state(vespalib::make_string("distributor:1 storage:%u .1.s:d", n_nodes));
+    timer.after();
+    fprintf(stderr, "Removing node 1 from %u buckets across %u stripes took %g seconds\n",
+            n_buckets, _num_distributor_stripes, timer.min_time());
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_FALSE(bucket_has_node(document::BucketId(32, i), 1));
+    }
+}
+
+
 TEST_F(TopLevelBucketDBUpdaterTest, storage_node_in_maintenance_clears_buckets_for_node) {
     ASSERT_NO_FATAL_FAILURE(set_storage_nodes(3));
     enable_distributor_cluster_state("distributor:1 storage:3");
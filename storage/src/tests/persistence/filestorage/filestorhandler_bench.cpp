@@ -0,0 +1,127 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <tests/common/storage_config_set.h>
+#include <tests/common/teststorageapp.h>
+#include <vespa/document/fieldset/fieldsets.h>
+#include <vespa/document/test/make_document_bucket.h>
+#include <vespa/storage/common/messagesender.h>
+#include <vespa/storage/persistence/filestorage/filestorhandlerimpl.h>
+#include <vespa/storage/persistence/filestorage/filestormetrics.h>
+#include <vespa/storageapi/message/persistence.h>
+#include <vespa/vespalib/gtest/gtest.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <atomic>
+#include <thread>
+
+using document::test::makeDocumentBucket;
+using namespace ::testing;
+
+namespace storage {
+
+namespace {
+
+// Replies (e.g. for operations timing out in the queue) are not interesting for the benchmark.
+struct NullMessageSender : MessageSender {
+    void sendCommand(const std::shared_ptr<api::StorageCommand>&) override {}
+    void sendReply(const std::shared_ptr<api::StorageReply>&) override {}
+};
+
+constexpr uint32_t num_producers = 8;
+constexpr uint32_t ops_per_producer = 50'000;
+constexpr uint32_t num_buckets = 4096;
+
+}
+
+struct FileStorHandlerBench : Test {
+    std::unique_ptr<StorageConfigSet>    _config;
+    std::unique_ptr<TestServiceLayerApp> _node;
+    NullMessageSender                    _sender;
+
+    FileStorHandlerBench();
+    ~FileStorHandlerBench() override;
+
+    std::vector<std::vector<std::shared_ptr<api::StorageMessage>>> make_ops() const {
+        std::vector<std::vector<std::shared_ptr<api::StorageMessage>>> ops(num_producers);
+        for (uint32_t p = 0; p < num_producers; ++p) {
+            ops[p].reserve(ops_per_producer);
+            for (uint32_t i = 0; i < ops_per_producer; ++i) {
+                const uint32_t bucket_key = (p * ops_per_producer + i) % num_buckets;
+                document::DocumentId id(vespalib::make_string("id:foo:testdoctype1:n=%u:%u", bucket_key, i));
+                auto bucket = makeDocumentBucket(document::BucketId(16, bucket_key));
+                ops[p].emplace_back(std::make_shared<api::GetCommand>(bucket, id, document::AllFields::NAME));
+            }
+        }
+        return ops;
+    }
+
+    // Returns the number of operations dequeued per second by `num_threads` persistence
+    // threads while `num_producers` threads concurrently schedule operations.
+    double measure_throughput(uint32_t num_threads) {
+        const uint32_t num_stripes = std::max(1u, num_threads / 2); // Same as FileStorManager
+        FileStorMetrics metrics;
+        metrics.initDiskMetrics(num_stripes, num_threads);
+        FileStorHandlerImpl handler(num_threads, num_stripes, _sender, metrics,
+                                    _node->getComponentRegister(), {}, {});
+        auto ops = make_ops();
+        const size_t total_ops = size_t(num_producers) * ops_per_producer;
+        std::atomic<size_t> dequeued(0);
+        std::atomic<bool> start(false);
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, stripe = t % num_stripes]() {
+                while (!start.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                while (dequeued.load(std::memory_order_relaxed) < total_ops) {
+                    auto locked = handler.getNextMessage(stripe, std::chrono::steady_clock::now() + 10ms);
+                    if (locked.msg) {
+                        dequeued.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (uint32_t p = 0; p < num_producers; ++p) {
+            threads.emplace_back([&, p]() {
+                while (!start.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                for (auto& op : ops[p]) {
+                    handler.schedule(op);
+                }
+            });
+        }
+        vespalib::BenchmarkTimer timer(0.0);
+        timer.before();
+        start.store(true, std::memory_order_release);
+        for (auto& t : threads) {
+            t.join();
+        }
+        timer.after();
+        EXPECT_EQ(handler.getQueueSize(), 0u);
+        return double(total_ops) / timer.min_time();
+    }
+};
+
+FileStorHandlerBench::FileStorHandlerBench()
+    : _config(StorageConfigSet::make_storage_node_config()),
+      _node(std::make_unique<TestServiceLayerApp>(NodeIndex(0), _config->config_uri())),
+      _sender()
+{
+    _node->setupDummyPersistence();
+}
+
+FileStorHandlerBench::~FileStorHandlerBench() = default;
+
+TEST_F(FileStorHandlerBench, dequeue_throughput_scales_with_persistence_threads) {
+    for (uint32_t num_threads : {8u, 16u, 32u, 64u}) {
+        double ops_per_sec = measure_throughput(num_threads);
+        fprintf(stderr, "%2u persistence threads (%u producers): %.0f ops/s\n",
+                num_threads, num_producers, ops_per_sec);
+    }
+}
+
+} // storage
+
+GTEST_MAIN_RUN_ALL_TESTS()
@@ -707,6 +707,37 @@ TEST_F(FileStorManagerTest, remap_split) {
               filestorHandler.dumpQueue());
 }
 
+TEST_F(FileStorManagerTest, concurrently_scheduled_operations_are_dequeued_in_per_producer_fifo_order) {
+    FileStorHandlerComponents c(*this);
+    auto& filestorHandler = *c.filestorHandler;
+    constexpr uint32_t num_producers = 4;
+    constexpr uint32_t ops_per_producer = 100;
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < ops_per_producer; ++i) {
+                filestorHandler.schedule(make_get_command(120, vespalib::make_string("id:foo:testdoctype1:n=%u:%u", p, i)));
+            }
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    EXPECT_EQ(num_producers * ops_per_producer, filestorHandler.getQueueSize());
+
+    std::vector<uint32_t> next_expected(num_producers, 0);
+    for (uint32_t n = 0; n < num_producers * ops_per_producer; ++n) {
+        auto locked = filestorHandler.getNextMessage(0);
+        ASSERT_TRUE(locked.msg);
+        const auto& id = static_cast<const api::GetCommand&>(*locked.msg).getDocumentId();
+        const uint32_t producer = id.getScheme().getNumber();
+        ASSERT_LT(producer, num_producers);
+        EXPECT_EQ(vespalib::make_string("%u", next_expected[producer]++), id.getScheme().getNamespaceSpecific());
+    }
+    EXPECT_EQ(0u, filestorHandler.getQueueSize());
+}
+
 TEST_F(FileStorManagerTest, handler_timeout) {
     FileStorHandlerComponents c(*this);
     auto& filestorHandler = *c.filestorHandler;
@@ -46,6 +46,10 @@ struct TestParams {
         _parallelBuckets = n;
         return *this;
     }
+    TestParams& prefetchBuckets(uint32_t n) {
+        _prefetchBuckets = n;
+        return *this;
+    }
     TestParams& autoReplyError(const mbus::Error& error) {
         _autoReplyError = error;
         return *this;
@@ -53,6 +57,7 @@ struct TestParams {
 
     uint32_t _maxVisitorMemoryUsage {UINT32_MAX};
     uint32_t _parallelBuckets {1};
+    uint32_t _prefetchBuckets {0};
     mbus::Error _autoReplyError;
 };
 
@@ -162,6 +167,7 @@ VisitorTest::initializeTest(const TestParams& params)
     _config = StorageConfigSet::make_storage_node_config();
     _config->visitor_config().visitorthreads = 1;
     _config->visitor_config().defaultparalleliterators = params._parallelBuckets;
+    _config->visitor_config().prefetchBuckets = params._prefetchBuckets;
     _config->visitor_config().visitorMemoryUsageLimit = params._maxVisitorMemoryUsage;
 
     _messageSessionFactory = std::make_unique<TestVisitorMessageSessionFactory>();
@@ -824,6 +830,87 @@ TEST_F(VisitorTest, no_more_iterators_sent_while_memory_used_above_limit) {
     ASSERT_TRUE(waitUntilNoActiveVisitors());
 }
 
+TEST_F(VisitorTest, only_one_get_iter_is_pending_per_bucket_while_prefetching_buckets) {
+    initializeTest(TestParams().parallelBuckets(1).prefetchBuckets(1));
+    auto cmd = makeCreateVisitor();
+    cmd->addBucketToBeVisited(document::BucketId(16, 4));
+    _top->sendDown(cmd);
+
+    std::vector<CreateIteratorCommand::SP> createCmds;
+    ASSERT_NO_FATAL_FAILURE(fetchMultipleCommands<CreateIteratorCommand>(*_bottom, 2, createCmds));
+    for (size_t i = 0; i < createCmds.size(); ++i) {
+        _bottom->sendUp(std::make_shared<CreateIteratorReply>(*createCmds[i], spi::IteratorId(1234 + i)));
+    }
+    std::vector<GetIterCommand::SP> getIterCmds;
+    ASSERT_NO_FATAL_FAILURE(fetchMultipleCommands<GetIterCommand>(*_bottom, 2, getIterCmds));
+    ASSERT_NE(getIterCmds[0]->getIteratorId(), getIterCmds[1]->getIteratorId());
+
+    // The persistence layer rejects a GetIter for an iterator that is already in use, so
+    // the next one for a bucket must not be sent before the previous one has been replied to.
+    sendGetIterReply(*getIterCmds[0], api::ReturnCode(api::ReturnCode::OK), 1);
+    GetIterCommand::SP getIterCmd;
+    ASSERT_NO_FATAL_FAILURE(fetchSingleCommand<GetIterCommand>(*_bottom, getIterCmd));
+    EXPECT_EQ(getIterCmds[0]->getIteratorId(), getIterCmd->getIteratorId());
+
+    MessageMeta meta;
+    getMessagesAndReply(1, getSession(0), meta);
+    sendGetIterReply(*getIterCmds[1], api::ReturnCode(api::ReturnCode::OK), 1, true);
+    getMessagesAndReply(1, getSession(0), meta);
+    sendGetIterReply(*getIterCmd, api::ReturnCode(api::ReturnCode::OK), 1, true);
+    getMessagesAndReply(1, getSession(0), meta);
+
+    std::vector<DestroyIteratorCommand::SP> destroyIterCmds;
+    ASSERT_NO_FATAL_FAILURE(fetchMultipleCommands<DestroyIteratorCommand>(*_bottom, 2, destroyIterCmds));
+
+    ASSERT_NO_FATAL_FAILURE(verifyCreateVisitorReply(api::ReturnCode::OK));
+    ASSERT_TRUE(waitUntilNoActiveVisitors());
+}
+
+TEST_F(VisitorTest, no_buckets_prefetched_while_client_window_is_half_full) {
+    initializeTest(TestParams().parallelBuckets(1).prefetchBuckets(1));
+    auto cmd = makeCreateVisitor();
+    cmd->addBucketToBeVisited(document::BucketId(16, 4));
+    cmd->addBucketToBeVisited(document::BucketId(16, 5));
+    cmd->setMaximumPendingReplyCount(2);
+    _top->sendDown(cmd);
+
+    // No messages pending towards the client; one bucket is prefetched.
+    std::vector<CreateIteratorCommand::SP> createCmds;
+    ASSERT_NO_FATAL_FAILURE(fetchMultipleCommands<CreateIteratorCommand>(*_bottom, 2, createCmds));
+    for (size_t i = 0; i < createCmds.size(); ++i) {
+        _bottom->sendUp(std::make_shared<CreateIteratorReply>(*createCmds[i], spi::IteratorId(1234 + i)));
+    }
+    std::vector<GetIterCommand::SP> getIterCmds;
+    ASSERT_NO_FATAL_FAILURE(fetchMultipleCommands<GetIterCommand>(*_bottom, 2, getIterCmds));
+    sendGetIterReply(*getIterCmds[0], api::ReturnCode(api::ReturnCode::OK), 1, true);
+
+    // One of two client messages is now pending, so the last bucket is not started until
+    // the client has caught up. As with the memory limit test above, the absence of a
+    // message can only be checked by waiting.
+    getSession(0).waitForMessages(1);
+    DestroyIteratorCommand::SP destroyIterCmd;
+    ASSERT_NO_FATAL_FAILURE(fetchSingleCommand<DestroyIteratorCommand>(*_bottom, destroyIterCmd));
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(0, _bottom->getNumCommands());
+
+    MessageMeta meta;
+    getMessagesAndReply(1, getSession(0), meta);
+    ASSERT_NO_FATAL_FAILURE(sendCreateIteratorReply(1236));
+
+    GetIterCommand::SP getIterCmd;
+    ASSERT_NO_FATAL_FAILURE(fetchSingleCommand<GetIterCommand>(*_bottom, getIterCmd));
+    sendGetIterReply(*getIterCmds[1], api::ReturnCode(api::ReturnCode::OK), 1, true);
+    getMessagesAndReply(1, getSession(0), meta);
+    sendGetIterReply(*getIterCmd, api::ReturnCode(api::ReturnCode::OK), 1, true);
+    getMessagesAndReply(1, getSession(0), meta);
+
+    std::vector<DestroyIteratorCommand::SP> destroyIterCmds;
+    ASSERT_NO_FATAL_FAILURE(fetchMultipleCommands<DestroyIteratorCommand>(*_bottom, 2, destroyIterCmds));
+
+    ASSERT_NO_FATAL_FAILURE(verifyCreateVisitorReply(api::ReturnCode::OK));
+    ASSERT_TRUE(waitUntilNoActiveVisitors());
+}
+
 void
 VisitorTest::doTestVisitorInstanceHasConsistencyLevel(
         std::string_view visitorType,
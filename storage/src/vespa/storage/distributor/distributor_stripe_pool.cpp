@@ -65,12 +65,16 @@ void DistributorStripePool::unpark_all_threads() noexcept {
     _parker_cond.wait(lock, [this]{ return (_parked_threads == 0); });
 }
 
+size_t DistributorStripePool::stripe_index_of_key(uint64_t key) const noexcept {
+    return stripe_of_bucket_key(key, _n_stripe_bits);
+}
+
 const TickableStripe& DistributorStripePool::stripe_of_key(uint64_t key) const noexcept {
-    return stripe_thread(stripe_of_bucket_key(key, _n_stripe_bits)).stripe();
+    return stripe_thread(stripe_index_of_key(key)).stripe();
 }
 
 TickableStripe& DistributorStripePool::stripe_of_key(uint64_t key) noexcept {
-    return stripe_thread(stripe_of_bucket_key(key, _n_stripe_bits)).stripe();
+    return stripe_thread(stripe_index_of_key(key)).stripe();
 }
 
 void DistributorStripePool::notify_stripe_event_has_triggered(size_t stripe_idx) noexcept {
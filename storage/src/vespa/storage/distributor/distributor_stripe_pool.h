@@ -82,6 +82,7 @@ public:
         return *_stripes[idx];
     }
     void notify_stripe_event_has_triggered(size_t stripe_idx) noexcept;
+    [[nodiscard]] size_t stripe_index_of_key(uint64_t key) const noexcept;
     [[nodiscard]] const TickableStripe& stripe_of_key(uint64_t key) const noexcept;
     [[nodiscard]] TickableStripe& stripe_of_key(uint64_t key) noexcept;
     [[nodiscard]] size_t stripe_count() const noexcept { return _stripes.size(); }
@@ -0,0 +1,52 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include "ideal_storage_nodes_calculator.h"
+#include <vespa/document/bucket/bucketid.h>
+#include <vespa/vdslib/distribution/distribution.h>
+#include <vespa/vdslib/state/clusterstate.h>
+
+namespace storage::distributor {
+
+namespace {
+
+constexpr uint64_t no_cached_superbucket = UINT64_MAX;
+
+uint64_t superbucket_from_id(const document::BucketId& id, uint16_t distribution_bits) noexcept {
+    // The n LSBs of the bucket ID contain the superbucket number. Mask off the rest.
+    return id.getRawId() & ~(UINT64_MAX << distribution_bits);
+}
+
+}
+
+IdealStorageNodesCalculator::IdealStorageNodesCalculator(const lib::ClusterState& state,
+                                                         const lib::Distribution& distribution,
+                                                         const char* up_states) noexcept
+    : _state(state),
+      _distribution(distribution),
+      _up_states(up_states),
+      _cached_superbucket(no_cached_superbucket),
+      _cached_nodes()
+{
+}
+
+IdealStorageNodesCalculator::~IdealStorageNodesCalculator() = default;
+
+const std::vector<uint16_t>&
+IdealStorageNodesCalculator::ideal_nodes(const document::BucketId& bucket_id) const
+{
+    const auto bits = _state.getDistributionBitCount();
+    const auto used_bits = bucket_id.getUsedBits();
+    const auto this_superbucket = superbucket_from_id(bucket_id, bits);
+    const bool cacheable = (used_bits >= bits) && (used_bits <= 33);
+    if (cacheable && (_cached_superbucket == this_superbucket)) {
+        return _cached_nodes;
+    }
+    // Invalidate up front, as the calculation below may throw after clearing the cached nodes.
+    _cached_superbucket = no_cached_superbucket;
+    _distribution.getIdealNodes(lib::NodeType::STORAGE, _state, bucket_id, _cached_nodes, _up_states);
+    if (cacheable) {
+        _cached_superbucket = this_superbucket;
+    }
+    return _cached_nodes;
+}
+
+}
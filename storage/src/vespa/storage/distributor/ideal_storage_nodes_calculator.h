@@ -0,0 +1,45 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace document { class BucketId; }
+
+namespace storage::lib {
+class ClusterState;
+class Distribution;
+}
+
+namespace storage::distributor {
+
+/**
+ * Calculator for the ideal storage node order of buckets. The ideal state of a
+ * bucket only depends on its super bucket (unless the bucket has more than 33
+ * used bits; see lib::Distribution::getStorageSeed), so the calculation is cached
+ * and reused for all consecutive sub-buckets under the same super bucket. The
+ * cache is invalidated when a new super bucket is encountered, so it only provides
+ * a benefit when invoked in bucket ID order.
+ *
+ * Not thread safe due to internal caching.
+ */
+class IdealStorageNodesCalculator {
+    const lib::ClusterState&      _state;
+    const lib::Distribution&      _distribution;
+    const char*                   _up_states;
+    mutable uint64_t              _cached_superbucket;
+    mutable std::vector<uint16_t> _cached_nodes;
+public:
+    IdealStorageNodesCalculator(const lib::ClusterState& state,
+                                const lib::Distribution& distribution,
+                                const char* up_states) noexcept;
+    ~IdealStorageNodesCalculator();
+
+    /**
+     * Returns the ideal storage nodes for the bucket. The returned reference is
+     * only valid until the next invocation.
+     */
+    [[nodiscard]] const std::vector<uint16_t>& ideal_nodes(const document::BucketId& bucket_id) const;
+};
+
+}
@@ -3,9 +3,36 @@
 #include "distributor_stripe.h"
 #include "distributor_stripe_pool.h"
 #include "distributor_stripe_thread.h"
+#include <vespa/vespalib/util/simple_thread_bundle.h>
+#include <exception>
 
 namespace storage::distributor {
 
+namespace {
+
+// Runs one stripe's part of a parallel operation. Exceptions are kept, so that every part
+// always completes and the thread bundle is never left waiting.
+template <typename Func>
+struct StripeTask final : vespalib::Runnable {
+    Func&              f;
+    size_t             stripe_idx;
+    TickableStripe&    stripe;
+    std::exception_ptr failure;
+
+    StripeTask(Func& f_in, size_t stripe_idx_in, TickableStripe& stripe_in) noexcept
+        : f(f_in), stripe_idx(stripe_idx_in), stripe(stripe_in), failure()
+    {}
+    void run() override {
+        try {
+            f(stripe_idx, stripe);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+    }
+};
+
+}
+
 MultiThreadedStripeAccessGuard::MultiThreadedStripeAccessGuard(
         MultiThreadedStripeAccessor& accessor,
         DistributorStripePool& stripe_pool)
@@ -70,10 +97,14 @@ MultiThreadedStripeAccessGuard::remove_superfluous_buckets(document::BucketSpace
                                                            const lib::ClusterState& new_state,
                                                            bool is_distribution_change)
 {
-    PotentialDataLossReport report;
-    for_each_stripe([&](TickableStripe& stripe) {
-        report.merge(stripe.remove_superfluous_buckets(bucket_space, new_state, is_distribution_change));
+    std::vector<PotentialDataLossReport> stripe_reports(_stripe_pool.stripe_count());
+    for_each_stripe_in_parallel([&](size_t stripe_idx, TickableStripe& stripe) {
+        stripe_reports[stripe_idx] = stripe.remove_superfluous_buckets(bucket_space, new_state, is_distribution_change);
     });
+    PotentialDataLossReport report;
+    for (const auto& stripe_report : stripe_reports) {
+        report.merge(stripe_report);
+    }
     return report;
 }
 
@@ -89,23 +120,20 @@ MultiThreadedStripeAccessGuard::merge_entries_into_db(document::BucketSpace buck
     if (entries.empty()) {
         return;
     }
-    std::vector<dbtransition::Entry> stripe_entries;
-    stripe_entries.reserve(entries.size() / _stripe_pool.stripe_count());
-    auto* curr_stripe = &_stripe_pool.stripe_of_key(entries[0].bucket_key);
-    stripe_entries.push_back(entries[0]);
-    for (size_t i = 1; i < entries.size(); ++i) {
-        const auto& entry = entries[i];
-        auto* next_stripe = &_stripe_pool.stripe_of_key(entry.bucket_key);
-        if (curr_stripe != next_stripe) {
-            curr_stripe->merge_entries_into_db(bucket_space, gathered_at_timestamp, distribution,
-                                               new_state, storage_up_states, outdated_nodes, stripe_entries);
-            stripe_entries.clear();
-        }
-        curr_stripe = next_stripe;
-        stripe_entries.push_back(entry);
+    // Entries are in bucket key order, so the relative order of entries is retained per stripe.
+    std::vector<std::vector<dbtransition::Entry>> stripe_entries(_stripe_pool.stripe_count());
+    for (auto& e : stripe_entries) {
+        e.reserve(entries.size() / _stripe_pool.stripe_count());
+    }
+    for (const auto& entry : entries) {
+        stripe_entries[_stripe_pool.stripe_index_of_key(entry.bucket_key)].push_back(entry);
     }
-    curr_stripe->merge_entries_into_db(bucket_space, gathered_at_timestamp, distribution,
-                                       new_state, storage_up_states, outdated_nodes, stripe_entries);
+    for_each_stripe_in_parallel([&](size_t stripe_idx, TickableStripe& stripe) {
+        if (!stripe_entries[stripe_idx].empty()) {
+            stripe.merge_entries_into_db(bucket_space, gathered_at_timestamp, distribution,
+                                         new_state, storage_up_states, outdated_nodes, stripe_entries[stripe_idx]);
+        }
+    });
 }
 
 void MultiThreadedStripeAccessGuard::update_read_snapshot_before_db_pruning() {
@@ -181,6 +209,32 @@ void MultiThreadedStripeAccessGuard::for_each_stripe(Func&& f) const {
     }
 }
 
+template <typename Func>
+void MultiThreadedStripeAccessGuard::for_each_stripe_in_parallel(Func&& f) {
+    // All stripe threads are parked while the guard is held, so the calling thread and the
+    // accessor's helper threads take their place. Stripes are fully independent of each other.
+    const size_t n_stripes = _stripe_pool.stripe_count();
+    std::vector<StripeTask<Func>> tasks;
+    tasks.reserve(n_stripes);
+    for (size_t i = 0; i < n_stripes; ++i) {
+        tasks.emplace_back(f, i, _stripe_pool.stripe_thread(i).stripe());
+    }
+    _accessor.helper_threads(n_stripes).run(tasks);
+    for (const auto& task : tasks) {
+        if (task.failure) {
+            std::rethrow_exception(task.failure);
+        }
+    }
+}
+
+MultiThreadedStripeAccessor::MultiThreadedStripeAccessor(DistributorStripePool& stripe_pool)
+    : _stripe_pool(stripe_pool),
+      _guard_held(false),
+      _helper_threads()
+{}
+
+MultiThreadedStripeAccessor::~MultiThreadedStripeAccessor() = default;
+
 std::unique_ptr<StripeAccessGuard> MultiThreadedStripeAccessor::rendezvous_and_hold_all() {
     // For sanity checking of invariant of only one guard being allowed at any given time.
     assert(!_guard_held);
@@ -193,4 +247,11 @@ void MultiThreadedStripeAccessor::mark_guard_released() {
     _guard_held = false;
 }
 
+vespalib::ThreadBundle& MultiThreadedStripeAccessor::helper_threads(size_t n_stripes) {
+    if (!_helper_threads || (_helper_threads->size() != n_stripes)) {
+        _helper_threads = std::make_unique<vespalib::SimpleThreadBundle>(n_stripes);
+    }
+    return *_helper_threads;
+}
+
 }
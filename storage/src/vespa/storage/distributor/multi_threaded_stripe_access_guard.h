@@ -3,6 +3,11 @@
 
 #include "stripe_access_guard.h"
 
+namespace vespalib {
+class SimpleThreadBundle;
+struct ThreadBundle;
+}
+
 namespace storage::distributor {
 
 class MultiThreadedStripeAccessor;
@@ -67,6 +72,12 @@ private:
 
     template <typename Func>
     void for_each_stripe(Func&& f) const;
+
+    // Invokes f(stripe_index, stripe) for all stripes concurrently on the accessor's helper
+    // threads and the calling thread. Only to be used for operations that touch nothing but
+    // stripe-local state. Returns once all stripes are done, rethrowing the first exception thrown.
+    template <typename Func>
+    void for_each_stripe_in_parallel(Func&& f);
 };
 
 /**
@@ -74,20 +85,21 @@ private:
  * in the provided stripe pool.
  */
 class MultiThreadedStripeAccessor : public StripeAccessor {
-    DistributorStripePool& _stripe_pool;
-    bool                   _guard_held;
+    DistributorStripePool&                     _stripe_pool;
+    bool                                       _guard_held;
+    // Takes the place of the parked stripe threads when a guard processes stripes in parallel.
+    // Created on first use, as the stripe count is not known before the pool is started.
+    std::unique_ptr<vespalib::SimpleThreadBundle> _helper_threads;
 
     friend class MultiThreadedStripeAccessGuard;
 public:
-    explicit MultiThreadedStripeAccessor(DistributorStripePool& stripe_pool)
-        : _stripe_pool(stripe_pool),
-          _guard_held(false)
-    {}
-    ~MultiThreadedStripeAccessor() override = default;
+    explicit MultiThreadedStripeAccessor(DistributorStripePool& stripe_pool);
+    ~MultiThreadedStripeAccessor() override;
 
     std::unique_ptr<StripeAccessGuard> rendezvous_and_hold_all() override;
 private:
     void mark_guard_released();
+    vespalib::ThreadBundle& helper_threads(size_t n_stripes);
 };
 
 }
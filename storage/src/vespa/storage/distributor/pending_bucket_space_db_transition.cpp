@@ -89,11 +89,7 @@ PendingBucketSpaceDbTransition::DbMerger::insertInfo(BucketDatabase::Entry& info
     std::vector<BucketCopy> copiesToAddOrUpdate(
             getCopiesThatAreNewOrAltered(info, range));
 
-    std::vector<uint16_t> order(
-            _distribution.getIdealStorageNodes(
-                    _new_state,
-                    _entries[range.first].bucket_id(),
-                    _storage_up_states));
+    const auto& order = _ideal_nodes_calc.ideal_nodes(_entries[range.first].bucket_id());
     info->addNodes(copiesToAddOrUpdate, order, TrustedUpdate::DEFER);
 }
 
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #pragma once
 
+#include "ideal_storage_nodes_calculator.h"
 #include "pending_bucket_space_db_transition_entry.h"
 #include "outdated_nodes.h"
 #include <vespa/document/bucket/bucketspace.h>
@@ -73,9 +74,7 @@ public:
     // is actually diffed and merged into a database.
     class DbMerger : public BucketDatabase::MergingProcessor {
         api::Timestamp _creation_timestamp;
-        const lib::Distribution& _distribution;
-        const lib::ClusterState& _new_state;
-        const char* _storage_up_states;
+        IdealStorageNodesCalculator _ideal_nodes_calc;
         const OutdatedNodes & _outdated_nodes; // TODO hash_set
         const std::vector<dbtransition::Entry>& _entries;
         uint32_t _iter;
@@ -87,9 +86,7 @@ public:
                  const OutdatedNodes & outdated_nodes,
                  const std::vector<dbtransition::Entry>& entries)
             : _creation_timestamp(creation_timestamp),
-              _distribution(distribution),
-              _new_state(new_state),
-              _storage_up_states(storage_up_states),
+              _ideal_nodes_calc(new_state, distribution, storage_up_states),
               _outdated_nodes(outdated_nodes),
               _entries(entries),
               _iter(0)
@@ -673,6 +673,7 @@ StripeBucketDBUpdater::MergingNodeRemover::MergingNodeRemover(
       _distribution(distribution),
       _upStates(upStates),
       _ownership_calc(_state, _distribution, localIndex),
+      _ideal_nodes_calc(_state, _distribution, _upStates),
       _track_non_owned_entries(track_non_owned_entries)
 {
     const uint16_t storage_count = s.getNodeCount(lib::NodeType::STORAGE);
@@ -712,8 +713,7 @@ StripeBucketDBUpdater::MergingNodeRemover::setCopiesInEntry(
 {
     e->clear();
 
-    std::vector<uint16_t> order =
-            _distribution.getIdealStorageNodes(_state, e.getBucketId(), _upStates);
+    const auto& order = _ideal_nodes_calc.ideal_nodes(e.getBucketId());
 
     e->addNodes(copies, order);
 
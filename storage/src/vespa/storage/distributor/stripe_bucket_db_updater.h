@@ -5,6 +5,7 @@
 #include "bucketlistmerger.h"
 #include "distributor_stripe_component.h"
 #include "distributormessagesender.h"
+#include "ideal_storage_nodes_calculator.h"
 #include "operation_routing_snapshot.h"
 #include "outdated_nodes_map.h"
 #include "pendingclusterstate.h"
@@ -225,6 +226,7 @@ private:
         const lib::Distribution&           _distribution;
         const char*                        _upStates;
         BucketOwnershipCalculator          _ownership_calc;
+        IdealStorageNodesCalculator        _ideal_nodes_calc;
         bool                               _track_non_owned_entries;
     };
 
@@ -90,6 +90,60 @@ FileStorHandlerImpl::~FileStorHandlerImpl()
 
 FileStorHandlerImpl::PriorityQueue::~PriorityQueue() = default;
 
+FileStorHandlerImpl::MessageInbox::MessageInbox() noexcept
+    : _head(nullptr),
+      _size(0),
+      _waiting_consumers(0)
+{}
+
+FileStorHandlerImpl::MessageInbox::~MessageInbox()
+{
+    Node* node = _head.load(std::memory_order_acquire);
+    while (node != nullptr) {
+        std::unique_ptr<Node> owned(node);
+        node = node->next;
+    }
+}
+
+void
+FileStorHandlerImpl::MessageInbox::push(MessageEntry entry)
+{
+    auto* node = new Node(std::move(entry));
+    // Increment before publishing, so that the size is never observed as lower than the actual count.
+    _size.fetch_add(1, std::memory_order_relaxed);
+    Node* old_head = _head.load(std::memory_order_relaxed);
+    do {
+        node->next = old_head;
+    } while (!_head.compare_exchange_weak(old_head, node, std::memory_order_seq_cst, std::memory_order_relaxed));
+}
+
+size_t
+FileStorHandlerImpl::MessageInbox::drain_into(PriorityQueue& queue)
+{
+    Node* node = _head.exchange(nullptr, std::memory_order_acq_rel);
+    if (node == nullptr) {
+        return 0;
+    }
+    // Nodes are linked newest first; reverse the list to preserve scheduling order
+    // in the priority queue (which is FIFO for operations of equal priority).
+    Node* fifo = nullptr;
+    while (node != nullptr) {
+        Node* next = node->next;
+        node->next = fifo;
+        fifo = node;
+        node = next;
+    }
+    size_t moved = 0;
+    while (fifo != nullptr) {
+        std::unique_ptr<Node> owned(fifo);
+        fifo = fifo->next;
+        queue.emplace_back(std::move(owned->entry));
+        ++moved;
+    }
+    _size.fetch_sub(moved, std::memory_order_relaxed);
+    return moved;
+}
+
 void
 FileStorHandlerImpl::addMergeStatus(const document::Bucket& bucket, std::shared_ptr<MergeStatus> status)
 {
@@ -736,6 +790,13 @@ FileStorHandlerImpl::remapMessage(api::StorageMessage& msg, const document::Buck
 void
 FileStorHandlerImpl::remapQueueNoLock(const RemapInfo& source, std::vector<RemapInfo*>& targets, Operation op)
 {
+    // All involved stripe locks are held. Drain the inboxes of both the source and the
+    // targets so that remapped operations retain their ordering relative to operations
+    // already scheduled to the target buckets.
+    stripe(source.bucket).unsafe_drain_inbox();
+    for (const auto *target: targets) {
+        stripe(target->bucket).unsafe_drain_inbox();
+    }
     BucketIdxView idx = stripe(source.bucket).exposeBucketIdxView();
     auto range(idx.equal_range(source.bucket));
 
@@ -852,6 +913,7 @@ void
 FileStorHandlerImpl::Stripe::failOperations(const document::Bucket &bucket, const api::ReturnCode& err)
 {
     std::lock_guard guard(*_lock);
+    drain_inbox(guard);
 
     BucketIdxView idx = exposeBucketIdxView();
     std::pair<BucketIdxView::iterator, BucketIdxView::iterator> range(idx.equal_range(bucket));
@@ -941,6 +1003,7 @@ FileStorHandlerImpl::Stripe::Stripe(const FileStorHandlerImpl & owner, MessageSe
       _lock(std::make_unique<std::mutex>()),
       _cond(std::make_unique<std::condition_variable>()),
       _queue(std::make_unique<PriorityQueue>()),
+      _inbox(std::make_unique<MessageInbox>()),
       _cached_queue_size(_queue->size()),
       _lockedBuckets(),
       _active_maintenance_ops(0),
@@ -982,6 +1045,7 @@ FileStorHandlerImpl::Stripe::next_message_impl(monitor_guard& guard, vespalib::s
     // second attempt. This is key to allowing the run loop to register
     // ticks at regular intervals while not busy-waiting.
     for (int attempt = 0; (attempt < 2) && !_owner.isPaused(); ++attempt) {
+        drain_inbox(guard);
         PriorityIdxView idx = exposePriorityIdxView();
         PriorityIdxView::iterator iter(idx.begin()), end(idx.end());
         bool was_throttled = false;
@@ -1009,7 +1073,13 @@ FileStorHandlerImpl::Stripe::next_message_impl(monitor_guard& guard, vespalib::s
             // Depending on whether we were blocked due to no usable ops in queue or throttling,
             // wait for either the queue or throttler to (hopefully) have some fresh stuff for us.
             if (!was_throttled) {
-                _cond->wait_until(guard, deadline);
+                // Operations may have been pushed to the inbox since it was drained. Registering as
+                // a waiter prior to checking it ensures that any later push will signal us.
+                _inbox->register_waiting_consumer();
+                if (_inbox->empty()) {
+                    _cond->wait_until(guard, deadline);
+                }
+                _inbox->unregister_waiting_consumer();
             } else {
                 // Have to release lock before doing a blocking throttle token fetch, since it
                 // prevents RPC threads from pushing onto the queue.
@@ -1129,6 +1199,7 @@ FileStorHandlerImpl::Stripe::get_next_async_message(monitor_guard& guard)
     if (_owner.isPaused()) {
         return {};
     }
+    drain_inbox(guard);
     PriorityIdxView idx = exposePriorityIdxView();
     PriorityIdxView::iterator iter(idx.begin()), end(idx.end());
 
@@ -1209,6 +1280,7 @@ FileStorHandlerImpl::Stripe::abort(std::vector<std::shared_ptr<api::StorageReply
                                    const AbortBucketOperationsCommand& cmd)
 {
     std::lock_guard lockGuard(*_lock);
+    drain_inbox(lockGuard);
     PriorityIdxView idx = exposePriorityIdxView();
     for (auto it = idx.begin(); it != idx.end();) {
         const MessageEntry &entry = *it;
@@ -1223,15 +1295,25 @@ FileStorHandlerImpl::Stripe::abort(std::vector<std::shared_ptr<api::StorageReply
     update_cached_queue_size(lockGuard);
 }
 
+void
+FileStorHandlerImpl::Stripe::drain_inbox_impl() const
+{
+    if (_inbox->drain_into(*_queue) != 0) {
+        _cached_queue_size.store_relaxed(_queue->size());
+    }
+}
+
 bool
 FileStorHandlerImpl::Stripe::schedule(MessageEntry messageEntry)
 {
-    {
-        std::lock_guard guard(*_lock);
-        _queue->emplace_back(std::move(messageEntry));
-        update_cached_queue_size(guard);
+    _inbox->push(std::move(messageEntry));
+    if (_inbox->has_waiting_consumers()) {
+        // A waiting consumer holds the stripe lock from before it checks the inbox until it
+        // blocks on the condition variable. Acquiring the lock once ensures that it has either
+        // seen our entry or is blocked and will receive the notification.
+        { std::lock_guard guard(*_lock); }
+        _cond->notify_one();
     }
-    _cond->notify_one();
     return true;
 }
 
@@ -1239,6 +1321,7 @@ FileStorHandler::LockedMessage
 FileStorHandlerImpl::Stripe::schedule_and_get_next_async_message(MessageEntry entry)
 {
     std::unique_lock guard(*_lock);
+    drain_inbox(guard);
     _queue->emplace_back(std::move(entry));
     update_cached_queue_size(guard);
     auto lockedMessage = get_next_async_message(guard);
@@ -1252,9 +1335,11 @@ void
 FileStorHandlerImpl::Stripe::flush()
 {
     std::unique_lock guard(*_lock);
-    while (!(_queue->empty() && _lockedBuckets.empty())) {
-        LOG(debug, "Still %ld in queue and %ld locked buckets", _queue->size(), _lockedBuckets.size());
+    drain_inbox(guard);
+    while (!(_queue->empty() && _inbox->empty() && _lockedBuckets.empty())) {
+        LOG(debug, "Still %ld in queue and %ld locked buckets", _queue->size() + _inbox->size(), _lockedBuckets.size());
         _cond->wait_for(guard, 100ms);
+        drain_inbox(guard);
     }
 }
 
@@ -1472,6 +1557,7 @@ void
 FileStorHandlerImpl::Stripe::dumpQueueHtml(std::ostream & os) const
 {
     std::lock_guard guard(*_lock);
+    drain_inbox(guard);
 
     ConstPriorityIdxView idx = exposePriorityIdxView();
     for (const auto & entry : idx) {
@@ -1513,6 +1599,7 @@ void
 FileStorHandlerImpl::Stripe::dumpQueue(std::ostream & os) const
 {
     std::lock_guard guard(*_lock);
+    drain_inbox(guard);
     ConstPriorityIdxView idx = exposePriorityIdxView();
     for (const auto & entry : idx) {
         os << entry._bucket.getBucketId() << ": "
@@ -198,6 +198,51 @@ public:
         ByBucketSet _sequence_ids_by_bucket;
     };
 
+    /**
+     * Multi-producer, single-consumer inbox of operations scheduled onto a stripe.
+     *
+     * Producers (typically RPC threads) push entries without taking the stripe lock.
+     * Entries are only ever removed by a thread holding the stripe lock, which moves
+     * all pending entries into the stripe's priority queue (in scheduling order)
+     * before inspecting it. Persistence threads therefore only contend with each
+     * other, and not with the threads feeding the stripe.
+     */
+    class MessageInbox {
+    public:
+        MessageInbox() noexcept;
+        MessageInbox(const MessageInbox &) = delete;
+        MessageInbox & operator=(const MessageInbox &) = delete;
+        ~MessageInbox();
+
+        void push(MessageEntry entry);
+        // Precondition: caller holds the lock of the owning stripe.
+        size_t drain_into(PriorityQueue& queue);
+
+        [[nodiscard]] bool empty() const noexcept {
+            return (_head.load(std::memory_order_seq_cst) == nullptr);
+        }
+        // May transiently over-count, but never under-count, the number of pending entries.
+        [[nodiscard]] size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+        // A consumer registers itself as waiting _before_ its final check of the inbox prior to
+        // blocking on the stripe condition variable. Producers observing a registered waiter
+        // must signal it, which avoids touching the stripe lock when all consumers are busy.
+        void register_waiting_consumer() noexcept { _waiting_consumers.fetch_add(1, std::memory_order_seq_cst); }
+        void unregister_waiting_consumer() noexcept { _waiting_consumers.fetch_sub(1, std::memory_order_relaxed); }
+        [[nodiscard]] bool has_waiting_consumers() const noexcept {
+            return (_waiting_consumers.load(std::memory_order_seq_cst) != 0);
+        }
+    private:
+        struct Node {
+            MessageEntry entry;
+            Node*        next;
+            explicit Node(MessageEntry entry_in) noexcept : entry(std::move(entry_in)), next(nullptr) {}
+        };
+        std::atomic<Node*>    _head;
+        std::atomic<size_t>   _size;
+        std::atomic<uint32_t> _waiting_consumers;
+    };
+
     using ConstPriorityIdxView = PriorityQueue::ConstPriorityIdxView;
     using PriorityIdxView = PriorityQueue::PriorityIdxView;
     using BucketIdxView = PriorityQueue::BucketIdxView;
@@ -260,10 +305,16 @@ public:
         void broadcast() {
             _cond->notify_all();
         }
-        size_t get_cached_queue_size() const { return _cached_queue_size.load_relaxed(); }
+        size_t get_cached_queue_size() const {
+            return _cached_queue_size.load_relaxed() + _inbox->size();
+        }
         void unsafe_update_cached_queue_size() {
             _cached_queue_size.store_relaxed(_queue->size());
         }
+        // Precondition: the stripe lock is held by the caller (see exposeLock()).
+        void unsafe_drain_inbox() {
+            drain_inbox_impl();
+        }
 
         void release(const document::Bucket & bucket, api::LockingRequirements reqOfReleasedLock,
                      api::StorageMessage::Id lockMsgId, bool was_active_maintenance);
@@ -294,12 +345,19 @@ public:
         void setMetrics(FileStorStripeMetrics * metrics) { _metrics = metrics; }
         [[nodiscard]] ActiveOperationsStats get_active_operations_stats(bool reset_min_max) const;
     private:
-        void update_cached_queue_size(const std::lock_guard<std::mutex> &) {
+        void update_cached_queue_size(const std::lock_guard<std::mutex> &) const {
             _cached_queue_size.store_relaxed(_queue->size());
         }
-        void update_cached_queue_size(const std::unique_lock<std::mutex> &) {
+        void update_cached_queue_size(const std::unique_lock<std::mutex> &) const {
             _cached_queue_size.store_relaxed(_queue->size());
         }
+        void drain_inbox(const std::lock_guard<std::mutex> &) const {
+            drain_inbox_impl();
+        }
+        void drain_inbox(const std::unique_lock<std::mutex> &) const {
+            drain_inbox_impl();
+        }
+        void drain_inbox_impl() const;
         [[nodiscard]] bool hasActive(monitor_guard & monitor, const AbortBucketOperationsCommand& cmd) const;
         [[nodiscard]] FileStorHandler::LockedMessage get_next_async_message(monitor_guard& guard);
         [[nodiscard]] bool operation_type_should_be_throttled(api::MessageType::Id type_id) const noexcept;
@@ -321,7 +379,9 @@ public:
         std::unique_ptr<std::mutex>                _lock;
         std::unique_ptr<std::condition_variable>   _cond;
         std::unique_ptr<PriorityQueue>  _queue;
-        atomic_size_t                   _cached_queue_size;
+        std::unique_ptr<MessageInbox>   _inbox;
+        // Mutable since draining the inbox (which may happen when dumping the queue) moves entries to _queue.
+        mutable atomic_size_t           _cached_queue_size;
         LockedBuckets                   _lockedBuckets;
         uint32_t                        _active_maintenance_ops;
         mutable SafeActiveOperationsStats _active_operations_stats;
@@ -88,7 +88,10 @@ FileStorThreadMetrics::OpWithNotFound::OpWithNotFound(const std::string& id, con
       notFound("not_found", {},
                "Number of requests that could not be completed due to source document not found.",
                this)
-{ }
+{
+    // Bumped from the persistence provider's completion threads (e.g. for removes of missing documents).
+    notFound.shardAcrossThreads();
+}
 
 FileStorThreadMetrics::OpWithNotFound::~OpWithNotFound() = default;
 
@@ -173,7 +176,10 @@ FileStorThreadMetrics::FileStorThreadMetrics(const std::string& name, const std:
       getBucketDiffReply("getbucketdiffreply", {}, "Number of getbucketdiff replies that have been processed.", this),
       applyBucketDiffReply("applybucketdiffreply", {}, "Number of applybucketdiff replies that have been processed.", this),
       merge_handler_metrics(this)
-{ }
+{
+    // Bumped when replying, which for async operations happens on the persistence provider's completion threads.
+    failedOperations.shardAcrossThreads();
+}
 
 FileStorThreadMetrics::~FileStorThreadMetrics() = default;
 
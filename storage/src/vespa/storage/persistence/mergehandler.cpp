@@ -433,8 +433,10 @@ MergeHandler::fetchLocalData(
 
     document::BucketIdFactory idFactory;
     const document::DocumentTypeRepo & repo = _env.getDocumentTypeRepo();
+    // Reused across documents to avoid a buffer allocation per serialized document
+    vespalib::nbostream stream;
 
-    for (const auto& entry_ptr : entries) {
+    for (auto& entry_ptr : entries) {
         const auto& docEntry = *entry_ptr;
         LOG(spam, "fetchLocalData: processing %s", docEntry.toString().c_str());
 
@@ -450,10 +452,9 @@ MergeHandler::fetchLocalData(
             assert(doc != nullptr);
             assertContainedInBucket(doc->getId(), bucket, idFactory);
             e._docName = doc->getId().toString();
-            vespalib::nbostream stream;
+            stream.clear();
             doc->serialize(stream);
-            e._headerBlob.resize(stream.size());
-            memcpy(&e._headerBlob[0], stream.peek(), stream.size());
+            e._headerBlob.assign(stream.peek(), stream.peek() + stream.size());
             e._bodyBlob.clear();
         } else {
             const document::DocumentId* docId = docEntry.getDocumentId();
@@ -468,6 +469,9 @@ MergeHandler::fetchLocalData(
             }
         }
         e._repo = &repo;
+        // The serialized form is all that is needed from here on; release the
+        // document right away to not hold two copies of the whole chunk in memory.
+        entry_ptr.reset();
      }
 
     for (auto& e : diff) {
@@ -150,6 +150,7 @@ Visitor::VisitorOptions::VisitorOptions()
       _toTime(framework::MicroSecTime::max()),
       _maxParallel(1),
       _maxParallelOneBucket(2),
+      _prefetchBuckets(0),
       _maxPending(1),
       _fieldSet(document::AllFields::NAME),
       _visitRemoves(false)
@@ -728,7 +729,10 @@ Visitor::onGetIterReply(const std::shared_ptr<GetIterReply>& reply, VisitorThrea
     }
 
     BucketIterationState& bucketState(**it);
-    bucketState.setCompleted(reply->isCompleted());
+    // Once completed, a late reply for the same bucket must not make it incomplete again.
+    if (reply->isCompleted()) {
+        bucketState.setCompleted();
+    }
     --bucketState._pendingIterators;
     if (!reply->getEntries().empty()) {
         LOG(debug, "Processing documents in handle given from bucket %s.", reply->getBucketId().toString().c_str());
@@ -1005,6 +1009,19 @@ Visitor::getStatus(std::ostream& out, bool verbose) const
     out << "\n";
 }
 
+uint32_t
+Visitor::maxParallelBuckets() const
+{
+    if (_visitorOptions._prefetchBuckets == 0) {
+        return _visitorOptions._maxParallel;
+    }
+    const size_t clientPending = _messageSession->pending() + _visitorTarget._queuedMessages.size();
+    if (clientPending * 2 >= _visitorOptions._maxPending) {
+        return _visitorOptions._maxParallel;
+    }
+    return _visitorOptions._maxParallel + _visitorOptions._prefetchBuckets;
+}
+
 bool
 Visitor::getIterators()
 {
@@ -1072,7 +1089,8 @@ Visitor::getIterators()
     // and below maxPending
     // start iterating a new bucket
     uint32_t sentCount = 0;
-    while (_bucketStates.size() < _visitorOptions._maxParallel &&
+    const uint32_t maxParallel = maxParallelBuckets();
+    while (_bucketStates.size() < maxParallel &&
            _bucketStates.size() < _visitorOptions._maxPending &&
            _currentBucket < _buckets.size())
     {
@@ -175,6 +175,9 @@ private:
         uint32_t _maxParallel;
         // Number of pending get iter operations per bucket
         uint32_t _maxParallelOneBucket;
+        // Buckets that can be visited in parallel in addition to _maxParallel
+        // while the client keeps up
+        uint32_t _prefetchBuckets;
 
         // Maximum number of messages sent to clients that have not yet been
         // replied to (max size to _sentMessages map)
@@ -476,6 +479,7 @@ public:
 
     void setMaxParallel(uint32_t maxParallel) { _visitorOptions._maxParallel = maxParallel; }
     void setMaxParallelPerBucket(uint32_t max) { _visitorOptions._maxParallelOneBucket = max; }
+    void setPrefetchBuckets(uint32_t prefetch) { _visitorOptions._prefetchBuckets = prefetch; }
 
     /**
      * Sends a message to the data handler for this visitor.
@@ -502,6 +506,15 @@ private:
      */
     bool getIterators();
 
+    /**
+     * Number of buckets that may be visited in parallel right now. Up to
+     * _prefetchBuckets more than _maxParallel while the client keeps up with
+     * the messages we send it, but no more than _maxParallel once half the
+     * pending window towards the client is in use, to avoid buffering
+     * documents that cannot be sent anyway.
+     */
+    [[nodiscard]] uint32_t maxParallelBuckets() const;
+
     /**
      * Attempt to send the message kept in msgMeta over the destination session,
      * automatically queuing for future transmission if a maximum number of
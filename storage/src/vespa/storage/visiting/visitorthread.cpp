@@ -88,6 +88,7 @@ VisitorThread::VisitorThread(uint32_t threadIndex,
       _threadIndex(threadIndex),
       _defaultParallelIterators(0),
       _iteratorsPerBucket(1),
+      _prefetchBuckets(0),
       _visitorMemoryUsageLimit(UINT32_MAX),
       _timeBetweenTicks(1000),
       _component(componentRegister, getThreadName(threadIndex)),
@@ -444,6 +445,7 @@ VisitorThread::onCreateVisitor(const std::shared_ptr<api::CreateVisitorCommand>&
 
         visitor->setMaxParallel(_defaultParallelIterators);
         visitor->setMaxParallelPerBucket(_iteratorsPerBucket);
+        visitor->setPrefetchBuckets(_prefetchBuckets);
 
         visitor->setDocBlockSize(DEFAULT_DOCBLOCK_SIZE);
         visitor->setMemoryUsageLimit(_visitorMemoryUsageLimit);
@@ -546,17 +548,22 @@ VisitorThread::onInternal(const std::shared_ptr<api::InternalCommand>& cmd)
                        "thread %u: "
                        "Current config(defaultParallelIterators %u,"
                        " iteratorsPerBucket %u,"
+                       " prefetchBuckets %u,"
                        " visitorMemoryUsageLimit %u)"
                        "New config(defaultParallelIterators %u,"
+                       " prefetchBuckets %u,"
                        " visitorMemoryUsageLimit %u)",
                        _threadIndex,
                        _defaultParallelIterators,
                        _iteratorsPerBucket,
+                       _prefetchBuckets,
                        _visitorMemoryUsageLimit,
                        config.defaultparalleliterators,
+                       config.prefetchBuckets,
                        config.visitorMemoryUsageLimit
                );
             _defaultParallelIterators = config.defaultparalleliterators;
+            _prefetchBuckets = (config.prefetchBuckets > 0) ? config.prefetchBuckets : 0;
             _visitorMemoryUsageLimit = config.visitorMemoryUsageLimit;
             if (_defaultParallelIterators < 1) {
                 LOG(config, "Cannot use value of defaultParallelIterators < 1");
@@ -651,6 +658,8 @@ VisitorThread::getStatus(vespalib::asciistream& out,
             << _defaultParallelIterators << "</td></tr>\n"
             << "<tr><td>Iterators per bucket</td><td>"
             << _iteratorsPerBucket << "</td></tr>\n"
+            << "<tr><td>Prefetch buckets</td><td>"
+            << _prefetchBuckets << "</td></tr>\n"
             << "<tr><td>Visitor memory usage limit</td><td>"
             << _visitorMemoryUsageLimit << "</td></tr>\n"
             << "</table>\n";
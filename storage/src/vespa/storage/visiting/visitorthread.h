@@ -77,6 +77,7 @@ class VisitorThread : public framework::Runnable,
     uint32_t _threadIndex;
     uint32_t _defaultParallelIterators;
     uint32_t _iteratorsPerBucket;
+    uint32_t _prefetchBuckets;
     uint32_t _visitorMemoryUsageLimit;
     std::atomic<uint32_t> _timeBetweenTicks;
     StorageComponent _component;
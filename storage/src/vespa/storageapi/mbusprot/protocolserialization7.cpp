@@ -1000,15 +1000,11 @@ void fill_api_apply_diff_vector(std::vector<api::ApplyBucketDiffCommand::Entry>&
         auto& dest = diff[i];
         dest._entry = get_diff_entry(proto_entry.entry_meta());
         dest._docName = proto_entry.document_id();
-        // TODO consider making buffers std::strings instead to avoid explicit zeroing-on-resize overhead
-        dest._headerBlob.resize(proto_entry.header_blob().size());
-        if (!proto_entry.header_blob().empty()) {
-            memcpy(dest._headerBlob.data(), proto_entry.header_blob().data(), proto_entry.header_blob().size());
-        }
-        dest._bodyBlob.resize(proto_entry.body_blob().size());
-        if (!proto_entry.body_blob().empty()) {
-            memcpy(dest._bodyBlob.data(), proto_entry.body_blob().data(), proto_entry.body_blob().size());
-        }
+        // Range assignment avoids the explicit zeroing of resize() prior to copying
+        const auto& header_blob = proto_entry.header_blob();
+        dest._headerBlob.assign(header_blob.begin(), header_blob.end());
+        const auto& body_blob = proto_entry.body_blob();
+        dest._bodyBlob.assign(body_blob.begin(), body_blob.end());
     }
 }
 
@@ -629,6 +629,13 @@ TEST(SearcherTest, utf8_substring_search) {
         testUTF8SubStringFieldSearcher(fs);
         EXPECT_EQ(HitsList({{{0, 0}, {0, 0}}}), search_string(fs, "aa", "aaaa"));
     }
+    {
+        UTF8SubStringFieldSearcher fs(0);
+        // Long enough for whole 16 byte blocks of ASCII, mixed with non-ASCII characters
+        std::string field = "OPERATORS and Operator Overloading, blåbærSYLTETØY";
+        EXPECT_EQ(HitsList({{{0, 0}, {0, 2}}, {{0, 4}}}), search_string(fs, StringList{"ato", "syl"}, field));
+        EXPECT_EQ(HitsList({{{0, 3}}}), search_string(fs, "loading", field));
+    }
     {
         UTF8SubStringFieldSearcher fs(0);
         EXPECT_EQ(HitsList({{{0, 0}, {0, 2}}}), search_string(fs, "abc", "abc bcd abc"));
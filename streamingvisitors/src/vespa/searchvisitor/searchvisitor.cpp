@@ -195,7 +195,9 @@ createAttribute(const std::string & name, const document::FieldValue & fv, searc
 SearchVisitor::AttrInfo::AttrInfo(vsm::FieldIdT fid, search::AttributeGuard::UP attr) noexcept
     : _field(fid),
       _attr(std::move(attr)),
-      _sort_blob_writer()
+      _sort_blob_writer(),
+      _fill_mode(FillMode::VALUE),
+      _value_field(fid)
 {
 }
 
@@ -544,6 +546,7 @@ SearchVisitor::init(const Parameters & params)
 
             _rankController.setRankManagerSnapshot(_env->get_rank_manager_snapshot());
             _rankController.setupRankProcessors(_query, location, wantedSummaryCount, ! _sortList.empty(), _attrMan, _attributeFields);
+            resolveAttributeFields();
             _element_gap_inspector.set_index_env(_rankController.getRankProcessor()->get_query_env().getIndexEnvironment());
 
             // This depends on _fieldPathMap (from setupScratchDocument),
@@ -1208,19 +1211,31 @@ SearchVisitor::match(const StorageDocument & doc)
     return hit;
 }
 
+void
+SearchVisitor::resolveAttributeFields()
+{
+    for (AttrInfo & finfo : _attributeFields) {
+        const AttributeGuard &finfoGuard(*finfo._attr);
+        const std::string & name = finfoGuard->getName();
+        if (finfoGuard->isIntegerType() && PositionDataType::isZCurveFieldName(name)) {
+            finfo._fill_mode = AttrInfo::FillMode::POSITION;
+            finfo._value_field = _fieldsUnion.find(PositionDataType::cutZCurveFieldName(name))->second;
+        } else if (name == "[docid]") {
+            finfo._fill_mode = AttrInfo::FillMode::DOCUMENT_ID;
+        } else if (name == "[rank]") {
+            finfo._fill_mode = AttrInfo::FillMode::RANK;
+        }
+    }
+}
+
 void
 SearchVisitor::fillAttributeVectors(const std::string & documentId, const StorageDocument & document)
 {
     for (const AttrInfo & finfo : _attributeFields) {
         const AttributeGuard &finfoGuard(*finfo._attr);
-        bool isPosition = finfoGuard->isIntegerType() && PositionDataType::isZCurveFieldName(finfoGuard->getName());
+        const bool isPosition = (finfo._fill_mode == AttrInfo::FillMode::POSITION);
         LOG(debug, "Filling attribute '%s',  isPosition='%s'", finfoGuard->getName().c_str(), isPosition ? "true" : "false");
-        uint32_t fieldId = finfo._field;
-        if (isPosition) {
-            std::string_view org = PositionDataType::cutZCurveFieldName(finfoGuard->getName());
-            fieldId = _fieldsUnion.find(org)->second;
-        }
-        const StorageDocument::SubDocument & subDoc = document.getComplexField(fieldId);
+        const StorageDocument::SubDocument & subDoc = document.getComplexField(finfo._value_field);
         auto & attrV = const_cast<AttributeVector & >(*finfoGuard);
         AttributeVector::DocId docId(0);
         attrV.addDoc(docId);
@@ -1234,10 +1249,10 @@ SearchVisitor::fillAttributeVectors(const std::string & documentId, const Storag
                 AttributeInserter ai(attrV, docId);
                 subDoc.getFieldValue()->iterateNested(subDoc.getRange(), ai);
             }
-        } else if (finfoGuard->getName() == "[docid]") {
+        } else if (finfo._fill_mode == AttrInfo::FillMode::DOCUMENT_ID) {
             _documentIdAttribute.add(documentId.c_str());
             // assert((_docsumCache.cache().size() + 1) == _documentIdAttribute.getNumDocs());
-        } else if (finfoGuard->getName() == "[rank]") {
+        } else if (finfo._fill_mode == AttrInfo::FillMode::RANK) {
             _shouldFillRankAttribute = true;
         }
     }
@@ -70,9 +70,19 @@ private:
          **/
         AttrInfo(vsm::FieldIdT fid, search::AttributeGuard::UP attr) noexcept;
 
+        /**
+         * How the attribute is filled for a matched document. Resolved once
+         * by resolveAttributeFields() instead of inspecting the attribute
+         * name for every document.
+         **/
+        enum class FillMode { VALUE, POSITION, DOCUMENT_ID, RANK };
+
         vsm::FieldIdT          _field;
         search::AttributeGuard::UP _attr;
         std::unique_ptr<search::attribute::ISortBlobWriter> _sort_blob_writer;
+        FillMode               _fill_mode;
+        // The document field holding the values; differs from _field for positions.
+        vsm::FieldIdT          _value_field;
     };
 
     /**
@@ -97,8 +107,8 @@ private:
     private:
         void onPrimitive(uint32_t fid, const Content & c) override;
         void onStructStart(const Content & fv) override;
-        document::Field _fieldX;
-        document::Field _fieldY;
+        const document::Field & _fieldX;
+        const document::Field & _fieldY;
         document::IntFieldValue _valueX;
         document::IntFieldValue _valueY;
     };
@@ -289,6 +299,12 @@ private:
      **/
     void setupAttributeVectorsForSorting(const search::common::SortSpec & sortList);
 
+    /**
+     * Resolve how each attribute in _attributeFields is filled for matched documents.
+     * Must be called after all attributes needed for ranking and sorting are set up.
+     **/
+    void resolveAttributeFields();
+
     /**
      * Setup grouping based on the given grouping blob.
      *
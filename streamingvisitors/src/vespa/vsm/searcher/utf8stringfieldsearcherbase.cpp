@@ -10,6 +10,22 @@ using search::byte;
 
 namespace vsm {
 
+namespace {
+
+#ifdef __x86_64__
+constexpr search::v16qi G_separator_limit = { 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+                                              0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f };
+
+// True if all 16 bytes are in the range 0x20-0x7f, i.e. 7-bit ASCII without
+// any separator characters. Bytes >= 0x80 compare as negative.
+inline bool is_printable_ascii16(const byte * p) noexcept {
+    search::v16qi current = __builtin_ia32_lddqu(reinterpret_cast<const char *>(p));
+    return __builtin_ia32_pmovmskb128(current > G_separator_limit) == 0xffff;
+}
+#endif
+
+}
+
 size_t
 UTF8StringFieldSearcherBase::matchTermRegular(const FieldRef & f, QueryTerm & qt)
 {
@@ -170,6 +186,15 @@ UTF8StringFieldSearcherBase::skipSeparators(const search::byte * p, size_t sz, T
     const search::byte * b(p);
 
     for(; p < e; ) {
+#ifdef __x86_64__
+        // Most text is plain ASCII; fold such runs without per character classification.
+        if ((e - p) >= 16 && is_printable_ascii16(p)) {
+            for (const search::byte * chunk_end(p + 16); p < chunk_end; p++) {
+                dstbuf.onCharacter(Fast_NormalizeWordFolder::lowercase_and_fold_ascii(*p), (p - b));
+            }
+            continue;
+        }
+#endif
         ucs4_t c(*p);
         const search::byte * oldP(p);
         if (c < 128) {
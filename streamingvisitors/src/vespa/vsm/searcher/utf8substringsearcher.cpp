@@ -2,6 +2,7 @@
 
 #include "utf8substringsearcher.h"
 #include <vespa/fastlib/text/unicodeutil.h>
+#include <bitset>
 
 using search::byte;
 using search::streaming::QueryTerm;
@@ -28,16 +29,29 @@ UTF8SubStringFieldSearcher::matchTerms(const FieldRef & f, const size_t mintsz)
     const cmptype_t * fn(fntemp);
     const cmptype_t * fe = fn + fl;
     const cmptype_t * fre = fe - mintsz;
+    // A term can only match where the field has its first character. Checking
+    // that up front avoids comparing against every term at every position.
+    std::bitset<256> firstChars;
+    for (auto qt : _qtl) {
+        const cmptype_t * term;
+        if (qt->term(term) > 0) {
+            firstChars.set(term[0] & 0xff);
+        } else {
+            firstChars.set();
+        }
+    }
     termcount_t words(0);
     for(words = 0; fn <= fre; ) {
-        for (auto qt : _qtl) {
-            const cmptype_t * term;
-            termsize_t tsz = qt->term(term);
-
-            const cmptype_t *tt=term, *et=term+tsz, *fnt=fn;
-            for (; (tt < et) && (*tt == *fnt); tt++, fnt++);
-            if (tt == et) {
-                addHit(*qt, words);
+        if (firstChars.test(*fn & 0xff)) {
+            for (auto qt : _qtl) {
+                const cmptype_t * term;
+                termsize_t tsz = qt->term(term);
+
+                const cmptype_t *tt=term, *et=term+tsz, *fnt=fn;
+                for (; (tt < et) && (*tt == *fnt); tt++, fnt++);
+                if (tt == et) {
+                    addHit(*qt, words);
+                }
             }
         }
         if ( ! Fast_UnicodeUtil::IsWordChar(*fn++) ) {
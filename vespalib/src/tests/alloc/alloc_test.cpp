@@ -8,6 +8,7 @@
 #include <vespa/vespalib/util/round_up_to_page_size.h>
 #include <vespa/vespalib/util/size_literals.h>
 #include <cstddef>
+#include <cstring>
 #include <sys/mman.h>
 
 using namespace vespalib;
@@ -139,6 +140,14 @@ TEST(AllocTest, rounding_of_large_mmaped_buffer) {
     EXPECT_EQ(MemoryAllocator::HUGEPAGE_SIZE*12ul, buf.size());
 }
 
+TEST(AllocTest, large_mmaped_buffer_is_aligned_to_huge_pages) {
+    for (size_t sz : {MemoryAllocator::HUGEPAGE_SIZE, MemoryAllocator::HUGEPAGE_SIZE*3+5}) {
+        Alloc buf = Alloc::allocMMap(sz);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buf.get()) % MemoryAllocator::HUGEPAGE_SIZE);
+        memset(buf.get(), 1, buf.size());
+    }
+}
+
 void verifyExtension(Alloc& buf, size_t currSZ, size_t newSZ) {
     bool expectSuccess = (currSZ != newSZ);
     void* oldPtr = buf.get();
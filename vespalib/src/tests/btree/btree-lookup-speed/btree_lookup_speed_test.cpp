@@ -0,0 +1,109 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/vespalib/btree/btreeroot.h>
+#include <vespa/vespalib/btree/btreebuilder.h>
+#include <vespa/vespalib/btree/btreenodeallocator.h>
+#include <vespa/vespalib/btree/btree.h>
+#include <vespa/vespalib/btree/btreenodeallocator.hpp>
+#include <vespa/vespalib/btree/btreenode.hpp>
+#include <vespa/vespalib/btree/btreenodestore.hpp>
+#include <vespa/vespalib/btree/btreeiterator.hpp>
+#include <vespa/vespalib/btree/btreeroot.hpp>
+#include <vespa/vespalib/btree/btreebuilder.hpp>
+#include <vespa/vespalib/btree/btree.hpp>
+#include <vespa/vespalib/datastore/buffer_type.hpp>
+#include <vespa/vespalib/util/time.h>
+#include <cassert>
+#include <random>
+#include <vector>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+using vespalib::btree::BTree;
+using vespalib::btree::BTreeTraits;
+
+/*
+ * Measures random lookups in a large B-tree with the node buffers
+ * backed by transparent huge pages and by ordinary pages. Transparent
+ * huge pages must be enabled ("madvise" or "always") in
+ * /sys/kernel/mm/transparent_hugepage/enabled for the two runs to
+ * differ. Large datastore buffers are placed on huge page boundaries
+ * unless VESPA_MMAP_HUGEPAGE_ALIGN_LIMIT is set to a larger value.
+ */
+class LookupSpeed
+{
+    template <typename Traits>
+    void work_loop(bool huge_pages);
+public:
+    int main();
+};
+
+namespace {
+
+bool set_huge_pages(bool enable)
+{
+#ifdef __linux__
+    return prctl(PR_SET_THP_DISABLE, enable ? 0 : 1, 0, 0, 0) == 0;
+#else
+    return !enable;
+#endif
+}
+
+}
+
+template <typename Traits>
+void
+LookupSpeed::work_loop(bool huge_pages)
+{
+    if (!set_huge_pages(huge_pages)) {
+        printf("Unable to %s transparent huge pages, skipping\n", huge_pages ? "enable" : "disable");
+        return;
+    }
+    using Tree = BTree<uint32_t, uint32_t, vespalib::btree::NoAggregated, std::less<uint32_t>, Traits>;
+    using Builder = typename Tree::Builder;
+    Tree tree;
+    Builder builder(tree.getAllocator());
+    size_t num_entries = 16000000;
+    size_t num_lookups = 20000000;
+    for (size_t i = 0; i < num_entries; ++i) {
+        builder.insert(i * 2, i);
+    }
+    tree.assign(builder);
+    assert(num_entries == tree.size());
+    std::minstd_rand rnd(42);
+    std::vector<uint32_t> keys(num_lookups);
+    for (auto& key : keys) {
+        key = (rnd() % num_entries) * 2;
+    }
+    uint64_t sum = 0;
+    vespalib::Timer timer;
+    for (uint32_t key : keys) {
+        auto itr = tree.find(key);
+        sum += itr.getData();
+    }
+    double used = vespalib::to_s(timer.elapsed());
+    printf("Elapsed time for %ld random lookups in %ld entries is %8.5f, "
+           "huge_pages=%s, fanout=%u,%u (sum=%lu)\n",
+           num_lookups, num_entries, used, huge_pages ? "true" : "false",
+           static_cast<int>(Traits::LEAF_SLOTS),
+           static_cast<int>(Traits::INTERNAL_SLOTS), sum);
+    fflush(stdout);
+}
+
+int
+LookupSpeed::main()
+{
+    using DefTraits = vespalib::btree::BTreeDefaultTraits;
+    using LargeTraits = BTreeTraits<32, 16, 10, true>;
+    work_loop<DefTraits>(false);
+    work_loop<DefTraits>(true);
+    work_loop<LargeTraits>(false);
+    work_loop<LargeTraits>(true);
+    return 0;
+}
+
+int main(int, char **) {
+    LookupSpeed app;
+    return app.main();
+}
@@ -43,7 +43,9 @@ struct Fixture {
     Selector<Context> selector;
     std::vector<SocketPair> sockets;
     std::vector<Context> contexts;
-    Fixture(size_t size, bool read_enabled, bool write_enabled) : wakeup(false), selector(), sockets(), contexts() {
+    Fixture(size_t size, bool read_enabled, bool write_enabled, SelectorBackend backend = SelectorBackend::EPOLL)
+      : wakeup(false), selector(backend), sockets(), contexts()
+    {
         for (size_t i = 0; i < size; ++i) {
             sockets.push_back(SocketPair::create());
             contexts.push_back(Context(sockets.back().a.get()));
@@ -182,6 +184,50 @@ TEST(SelectorTest, require_that_filling_the_output_buffer_disables_write_events)
     GTEST_DO(f1.reset().poll().verify(false, {in}));
 }
 
+TEST(SelectorTest, require_that_io_uring_backend_is_used_only_when_supported) {
+    Fixture f1(0, true, false, SelectorBackend::IO_URING);
+    SelectorBackend expect = IoUringPoll::is_supported() ? SelectorBackend::IO_URING : SelectorBackend::EPOLL;
+    EXPECT_TRUE(f1.selector.backend() == expect);
+    Fixture f2(0, true, false);
+    EXPECT_TRUE(f2.selector.backend() == SelectorBackend::EPOLL);
+}
+
+TEST(SelectorTest, require_that_io_uring_backend_reports_level_triggered_events) {
+    if (!IoUringPoll::is_supported()) {
+        GTEST_SKIP() << "io_uring not supported";
+    }
+    Fixture f1(3, true, true, SelectorBackend::IO_URING);
+    GTEST_DO(f1.reset().poll().verify(false, {out, out, out}));
+    EXPECT_TRUE(f1.write(1, "test"));
+    GTEST_DO(f1.reset().poll().verify(false, {out, both, out}));
+    GTEST_DO(f1.reset().poll().verify(false, {out, both, out}));
+    f1.update(0, false, false);
+    f1.update(2, true, false);
+    GTEST_DO(f1.reset().poll().verify(false, {none, both, none}));
+    EXPECT_TRUE(f1.read(1, strlen("test")));
+    f1.update(1, true, false);
+    GTEST_DO(f1.reset().poll(10).verify(false, {none, none, none}));
+    EXPECT_TRUE(f1.write(2, "test"));
+    f1.selector.wakeup();
+    GTEST_DO(f1.reset().poll().verify(true, {none, none, in}));
+    f1.selector.remove(f1.contexts[2].fd);
+    GTEST_DO(f1.reset().poll(10).verify(false, {none, none, none}));
+}
+
+TEST(SelectorTest, require_that_io_uring_backend_releases_removed_sources_right_away) {
+    if (!IoUringPoll::is_supported()) {
+        GTEST_SKIP() << "io_uring not supported";
+    }
+    Fixture f1(1, true, false, SelectorBackend::IO_URING);
+    GTEST_DO(f1.reset().poll(10).verify(false, {none}));
+    f1.selector.remove(f1.contexts[0].fd);
+    f1.sockets[0].a.reset();
+    // the peer sees the socket being closed without waiting for
+    // the selector to be polled again
+    char buf[16];
+    EXPECT_EQ(::read(f1.sockets[0].b.get(), buf, sizeof(buf)), 0);
+}
+
 TEST(SelectorTest, require_that_selector_can_be_woken_while_waiting_for_events) {
     size_t num_threads = 2;
     Fixture f1(0, true, false);
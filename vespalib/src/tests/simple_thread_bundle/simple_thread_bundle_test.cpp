@@ -210,6 +210,22 @@ TEST(SimpleThreadBundleTest, require_that_bundle_pool_reuses_bundles) {
     EXPECT_EQ(ptr, &bundle.bundle());
 }
 
+TEST(SimpleThreadBundleTest, require_that_bundle_pool_can_limit_the_number_of_bundles_handed_out) {
+    SimpleThreadBundle::Pool f1(3, Runnable::default_init_function, 2);
+    auto b1 = f1.try_obtain();
+    auto b2 = f1.try_obtain();
+    ASSERT_TRUE(b1);
+    ASSERT_TRUE(b2);
+    EXPECT_EQ(3u, b1->size());
+    EXPECT_FALSE(f1.try_obtain());
+    SimpleThreadBundle *ptr = b1.get();
+    f1.release(std::move(b1));
+    auto b3 = f1.try_obtain();
+    EXPECT_EQ(ptr, b3.get());
+    f1.release(std::move(b2));
+    f1.release(std::move(b3));
+}
+
 TEST(SimpleThreadBundleTest, require_that_bundle_pool_works_with_multiple_threads) {
     size_t num_threads = 32;
     SimpleThreadBundle::Pool f1(3);
@@ -450,6 +450,29 @@ TEST(StashTest, require_that_mark_revert_works_as_expected) {
     EXPECT_EQ(stash.count_used(), 0u);
 }
 
+TEST(StashTest, require_that_used_bytes_including_large_objects_are_tracked) {
+    Stash stash;
+    auto used = [&stash]() { return stash.get_memory_usage().usedBytes(); };
+    size_t destructed = 0;
+    EXPECT_EQ(stash.count_used_including_large(), 0u);
+    stash.create<Small>(destructed);
+    stash.create<Large>(destructed);
+    EXPECT_GT(stash.count_used_including_large(), stash.count_used());
+    EXPECT_EQ(stash.count_used_including_large(), used());
+    Stash::Mark mark = stash.mark();
+    size_t used_at_mark = stash.count_used_including_large();
+    stash.alloc(10_Ki);
+    stash.create<Large>(destructed);
+    EXPECT_EQ(stash.count_used_including_large(), used());
+    stash.revert(mark);
+    EXPECT_EQ(stash.count_used_including_large(), used_at_mark);
+    Stash moved(std::move(stash));
+    EXPECT_EQ(moved.count_used_including_large(), used_at_mark);
+    EXPECT_EQ(stash.count_used_including_large(), 0u);
+    moved.clear();
+    EXPECT_EQ(moved.count_used_including_large(), moved.count_used());
+}
+
 void check_array(std::span<float> arr, size_t expect_size) {
     EXPECT_EQ(arr.size(), expect_size);
     for (size_t i = 0; i < arr.size(); ++i) {
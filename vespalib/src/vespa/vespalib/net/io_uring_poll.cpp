@@ -0,0 +1,204 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "io_uring_poll.h"
+#include <vespa/config.h>
+#include <cstdlib>
+
+#ifdef VESPA_HAS_IO_URING
+
+#include <vespa/vespalib/util/require.h>
+#include <liburing.h>
+#include <poll.h>
+#include <cerrno>
+#include <unordered_map>
+#include <vector>
+
+namespace vespalib {
+
+namespace {
+
+uint32_t maybe(uint32_t value, bool yes) { return yes ? value : 0; }
+
+// User data for poll remove requests, whose completions are ignored.
+constexpr uint64_t ignored_user_data = 0;
+
+uint64_t make_user_data(int fd, uint32_t generation) {
+    return (uint64_t(uint32_t(fd)) << 32) | generation;
+}
+int fd_of(uint64_t user_data) { return int(uint32_t(user_data >> 32)); }
+uint32_t generation_of(uint64_t user_data) { return uint32_t(user_data); }
+
+}
+
+struct IoUringPoll::Impl {
+    struct Registration {
+        void     *ctx;
+        uint32_t  events;
+        uint32_t  generation; // identifies the currently armed poll request, if any
+        bool      armed;
+    };
+
+    io_uring                              _uring;
+    std::unordered_map<int, Registration> _fds;
+    std::vector<int>                      _rearm;
+    uint32_t                              _next_generation;
+
+    Impl() : _uring(), _fds(), _rearm(), _next_generation(0) {
+        int res = io_uring_queue_init(4096, &_uring, 0);
+        REQUIRE_EQ(res, 0);
+    }
+    ~Impl() {
+        io_uring_queue_exit(&_uring);
+    }
+    io_uring_sqe *get_sqe() {
+        auto *sqe = io_uring_get_sqe(&_uring);
+        while (sqe == nullptr) {
+            REQUIRE(io_uring_submit(&_uring) >= 0);
+            sqe = io_uring_get_sqe(&_uring);
+        }
+        return sqe;
+    }
+    uint32_t next_generation() {
+        if (++_next_generation == 0) {
+            ++_next_generation; // generation 0 is never used
+        }
+        return _next_generation;
+    }
+    void arm(int fd, Registration &reg) {
+        reg.generation = next_generation();
+        reg.armed = true;
+        auto *sqe = get_sqe();
+        io_uring_prep_poll_add(sqe, fd, reg.events);
+        io_uring_sqe_set_data(sqe, reinterpret_cast<void *>(make_user_data(fd, reg.generation)));
+    }
+    void disarm(int fd, Registration &reg) {
+        if (reg.armed) {
+            auto *sqe = get_sqe();
+            io_uring_prep_poll_remove(sqe, reinterpret_cast<void *>(make_user_data(fd, reg.generation)));
+            io_uring_sqe_set_data(sqe, reinterpret_cast<void *>(ignored_user_data));
+            reg.armed = false;
+        }
+    }
+    void add(int fd, void *ctx, bool read, bool write) {
+        auto [pos, inserted] = _fds.try_emplace(fd, Registration{ctx, maybe(POLLIN, read) | maybe(POLLOUT, write), 0, false});
+        REQUIRE(inserted);
+        arm(fd, pos->second);
+    }
+    void update(int fd, void *ctx, bool read, bool write) {
+        auto pos = _fds.find(fd);
+        REQUIRE(pos != _fds.end());
+        Registration &reg = pos->second;
+        uint32_t events = maybe(POLLIN, read) | maybe(POLLOUT, write);
+        if (reg.armed && (reg.events == events) && (reg.ctx == ctx)) {
+            return;
+        }
+        disarm(fd, reg);
+        reg.ctx = ctx;
+        reg.events = events;
+        arm(fd, reg);
+    }
+    void remove(int fd) {
+        auto pos = _fds.find(fd);
+        if (pos != _fds.end()) {
+            bool was_armed = pos->second.armed;
+            disarm(fd, pos->second);
+            _fds.erase(pos);
+            if (was_armed) {
+                // A pending poll request holds a reference to the
+                // file, keeping it alive after the caller closes the
+                // fd. Submit the removal right away instead of
+                // waiting for the next wait.
+                REQUIRE(io_uring_submit(&_uring) >= 0);
+            }
+        }
+    }
+    void rearm_completed() {
+        for (int fd: _rearm) {
+            auto pos = _fds.find(fd);
+            if ((pos != _fds.end()) && !pos->second.armed) {
+                arm(fd, pos->second);
+            }
+        }
+        _rearm.clear();
+    }
+    size_t wait(epoll_event *events, size_t max_events, int timeout_ms) {
+        // Poll requests that completed during the previous wait are
+        // re-armed only now, after the events have been handled. Since
+        // a poll request completes immediately if the file descriptor
+        // is already ready, this gives level-triggered semantics.
+        rearm_completed();
+        io_uring_cqe *cqe = nullptr;
+        int res;
+        if (timeout_ms < 0) {
+            res = io_uring_submit_and_wait(&_uring, 1);
+        } else {
+            REQUIRE(io_uring_submit(&_uring) >= 0);
+            __kernel_timespec ts;
+            ts.tv_sec = timeout_ms / 1000;
+            ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+            res = io_uring_wait_cqe_timeout(&_uring, &cqe, &ts);
+        }
+        REQUIRE((res >= 0) || (res == -ETIME) || (res == -EINTR));
+        size_t num_events = 0;
+        while ((num_events < max_events) && (io_uring_peek_cqe(&_uring, &cqe) == 0)) {
+            uint64_t user_data = reinterpret_cast<uint64_t>(io_uring_cqe_get_data(cqe));
+            int32_t result = cqe->res;
+            io_uring_cqe_seen(&_uring, cqe);
+            if (user_data == ignored_user_data) {
+                continue;
+            }
+            auto pos = _fds.find(fd_of(user_data));
+            if ((pos == _fds.end()) || (pos->second.generation != generation_of(user_data)) || !pos->second.armed) {
+                continue; // stale completion for a removed or updated registration
+            }
+            Registration &reg = pos->second;
+            reg.armed = false;
+            _rearm.push_back(pos->first);
+            events[num_events].data.ptr = reg.ctx;
+            events[num_events].events = (result >= 0) ? uint32_t(result) : uint32_t(EPOLLERR);
+            ++num_events;
+        }
+        return num_events;
+    }
+};
+
+IoUringPoll::IoUringPoll() : _impl(std::make_unique<Impl>()) {}
+IoUringPoll::~IoUringPoll() = default;
+
+bool
+IoUringPoll::is_supported()
+{
+    io_uring_probe *probe = io_uring_get_probe();
+    bool result = (probe != nullptr)
+                  && io_uring_opcode_supported(probe, IORING_OP_POLL_ADD)
+                  && io_uring_opcode_supported(probe, IORING_OP_POLL_REMOVE);
+    free(probe);
+    return result;
+}
+
+void IoUringPoll::add(int fd, void *ctx, bool read, bool write) { _impl->add(fd, ctx, read, write); }
+void IoUringPoll::update(int fd, void *ctx, bool read, bool write) { _impl->update(fd, ctx, read, write); }
+void IoUringPoll::remove(int fd) { _impl->remove(fd); }
+size_t IoUringPoll::wait(epoll_event *events, size_t max_events, int timeout_ms) {
+    return _impl->wait(events, max_events, timeout_ms);
+}
+
+}
+
+#else // VESPA_HAS_IO_URING
+
+namespace vespalib {
+
+struct IoUringPoll::Impl {};
+
+IoUringPoll::IoUringPoll() : _impl() { abort(); }
+IoUringPoll::~IoUringPoll() = default;
+bool IoUringPoll::is_supported() { return false; }
+void IoUringPoll::add(int, void *, bool, bool) { abort(); }
+void IoUringPoll::update(int, void *, bool, bool) { abort(); }
+void IoUringPoll::remove(int) { abort(); }
+size_t IoUringPoll::wait(epoll_event *, size_t, int) { abort(); }
+
+}
+
+#endif // VESPA_HAS_IO_URING
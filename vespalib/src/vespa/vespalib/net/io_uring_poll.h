@@ -0,0 +1,41 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#ifdef __APPLE__
+#include "emulated_epoll.h"
+#else
+#include "native_epoll.h"
+#endif
+#include <memory>
+
+namespace vespalib {
+
+/**
+ * Drop-in alternative to the Epoll class that uses io_uring poll
+ * requests to detect readiness. Changes to the set of monitored file
+ * descriptors are queued and submitted in a single batch together
+ * with the next wait, avoiding one epoll_ctl system call per change.
+ *
+ * Poll requests are single-shot and re-armed after each reported
+ * event, which preserves the level-triggered semantics of Epoll.
+ *
+ * Unlike Epoll, this class is not thread-safe; all functions must be
+ * called by the thread calling wait.
+ **/
+class IoUringPoll
+{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+public:
+    IoUringPoll();
+    ~IoUringPoll();
+    static bool is_supported();
+    void add(int fd, void *ctx, bool read, bool write);
+    void update(int fd, void *ctx, bool read, bool write);
+    void remove(int fd);
+    size_t wait(epoll_event *events, size_t max_events, int timeout_ms);
+};
+
+}
@@ -2,8 +2,24 @@
 
 #include "selector.h"
 
+#include <vespa/log/log.h>
+LOG_SETUP(".vespalib.net.selector");
+
 namespace vespalib {
 
+std::unique_ptr<IoUringPoll>
+make_io_uring_poll_if_selected(SelectorBackend backend)
+{
+    if (backend != SelectorBackend::IO_URING) {
+        return {};
+    }
+    if (!IoUringPoll::is_supported()) {
+        LOG(warning, "io_uring selector backend requested but not supported; using epoll");
+        return {};
+    }
+    return std::make_unique<IoUringPoll>();
+}
+
 namespace {
 
 //-----------------------------------------------------------------------------
@@ -3,11 +3,9 @@
 #pragma once
 
 #include "wakeup_pipe.h"
-#ifdef __APPLE__
-#include "emulated_epoll.h"
-#else
-#include "native_epoll.h"
-#endif
+#include "io_uring_poll.h"
+#include <memory>
+#include <optional>
 #include <vector>
 
 namespace vespalib {
@@ -25,6 +23,9 @@ public:
     void extract(Epoll &epoll, int timeout_ms) {
         _num_events = epoll.wait(&_epoll_events[0], _epoll_events.size(), timeout_ms);
     }
+    void extract(IoUringPoll &poll, int timeout_ms) {
+        _num_events = poll.wait(&_epoll_events[0], _epoll_events.size(), timeout_ms);
+    }
     const epoll_event *begin() const { return &_epoll_events[0]; }
     const epoll_event *end() const { return &_epoll_events[_num_events]; }
     size_t size() const { return _num_events; }
@@ -33,27 +34,61 @@ public:
 //-----------------------------------------------------------------------------
 enum class SelectorDispatchResult {WAKEUP_CALLED, NO_WAKEUP};
 
+/**
+ * Which mechanism a Selector uses to wait for events. IO_URING falls
+ * back to EPOLL if io_uring is not supported by the platform. Note
+ * that with IO_URING, the selection criteria may only be changed by
+ * the thread polling the selector.
+ **/
+enum class SelectorBackend {EPOLL, IO_URING};
+
+std::unique_ptr<IoUringPoll> make_io_uring_poll_if_selected(SelectorBackend backend);
+
 template <typename Context>
 class Selector
 {
 private:
-    Epoll       _epoll;
-    WakeupPipe  _wakeup_pipe;
-    EpollEvents _events;
+    std::unique_ptr<IoUringPoll> _uring; // exactly one of _uring and _epoll is present
+    std::optional<Epoll>         _epoll;
+    WakeupPipe                   _wakeup_pipe;
+    EpollEvents                  _events;
 public:
-    Selector()
-        : _epoll(), _wakeup_pipe(), _events(4096)
+    Selector() : Selector(SelectorBackend::EPOLL) {}
+    explicit Selector(SelectorBackend backend)
+        : _uring(make_io_uring_poll_if_selected(backend)), _epoll(), _wakeup_pipe(), _events(4096)
     {
-        _epoll.add(_wakeup_pipe.get_read_fd(), nullptr, true, false);
+        if (!_uring) {
+            _epoll.emplace();
+        }
+        add_impl(_wakeup_pipe.get_read_fd(), nullptr, true, false);
     }
     ~Selector() {
-        _epoll.remove(_wakeup_pipe.get_read_fd());
+        remove(_wakeup_pipe.get_read_fd());
+    }
+    SelectorBackend backend() const noexcept { return _uring ? SelectorBackend::IO_URING : SelectorBackend::EPOLL; }
+    void add(int fd, Context &ctx, bool read, bool write) { add_impl(fd, &ctx, read, write); }
+    void update(int fd, Context &ctx, bool read, bool write) {
+        if (_uring) {
+            _uring->update(fd, &ctx, read, write);
+        } else {
+            _epoll->update(fd, &ctx, read, write);
+        }
+    }
+    void remove(int fd) {
+        if (_uring) {
+            _uring->remove(fd);
+        } else {
+            _epoll->remove(fd);
+        }
     }
-    void add(int fd, Context &ctx, bool read, bool write) { _epoll.add(fd, &ctx, read, write); }
-    void update(int fd, Context &ctx, bool read, bool write) { _epoll.update(fd, &ctx, read, write); }
-    void remove(int fd) { _epoll.remove(fd); }
     void wakeup() { _wakeup_pipe.write_token(); }
-    void poll(int timeout_ms) { _events.extract(_epoll, timeout_ms); }
+    void poll(int timeout_ms) {
+        if (_uring) {
+            _events.extract(*_uring, timeout_ms);
+        } else {
+            _events.extract(*_epoll, timeout_ms);
+        }
+    }
     size_t num_events() const { return _events.size(); }
     template <typename Handler>
     SelectorDispatchResult dispatch(Handler &handler) {
@@ -72,6 +107,14 @@ public:
         }
         return result;
     }
+private:
+    void add_impl(int fd, void *ctx, bool read, bool write) {
+        if (_uring) {
+            _uring->add(fd, ctx, read, write);
+        } else {
+            _epoll->add(fd, ctx, read, write);
+        }
+    }
 };
 
 //-----------------------------------------------------------------------------
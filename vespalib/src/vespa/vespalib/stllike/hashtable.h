@@ -308,6 +308,11 @@ public:
         return end();
     }
     const_iterator find(const Key & key) const noexcept;
+    // Hint that the bucket for the given key will be looked up soon.
+    template< typename AltKey>
+    void prefetch(const AltKey & key) const noexcept {
+        __builtin_prefetch(&_nodes[hash(key)]);
+    }
     template <typename V>
     insert_result insert(V && node) {
         return insert_internal(std::forward<V>(node));
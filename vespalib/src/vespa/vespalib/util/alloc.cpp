@@ -29,6 +29,7 @@ bool _g_SilenceCoreOnOOM(false);
 int  _g_HugeFlags = 0;
 size_t _g_MMapLogLimit = std::numeric_limits<size_t>::max();
 size_t _g_MMapNoCoreLimit = std::numeric_limits<size_t>::max();
+size_t _g_MMapHugePageAlignLimit = alloc::MemoryAllocator::HUGEPAGE_SIZE;
 std::mutex _g_lock;
 std::atomic<size_t> _g_mmapCount(0);
 
@@ -74,6 +75,7 @@ void initializeEnvironment()
     _g_SilenceCoreOnOOM = (getenv("VESPA_SILENCE_CORE_ON_OOM") != nullptr) ? true : false;
     _g_MMapLogLimit = readOptionalEnvironmentVar("VESPA_MMAP_LOG_LIMIT", std::numeric_limits<size_t>::max());
     _g_MMapNoCoreLimit = readOptionalEnvironmentVar("VESPA_MMAP_NOCORE_LIMIT", std::numeric_limits<size_t>::max());
+    _g_MMapHugePageAlignLimit = readOptionalEnvironmentVar("VESPA_MMAP_HUGEPAGE_ALIGN_LIMIT", alloc::MemoryAllocator::HUGEPAGE_SIZE);
 }
 
 class Initialize {
@@ -83,6 +85,32 @@ public:
 
 Initialize _g_initializer;
 
+/*
+ * Transparent huge pages can only back the parts of a mapping that are
+ * aligned to the huge page size. Reserve enough address space to place
+ * the mapping on a huge page boundary and unmap the unaligned head and tail.
+ */
+void *
+mmap_huge_page_aligned(size_t sz, int prot, int flags)
+{
+    size_t reserved_sz = sz + alloc::MemoryAllocator::HUGEPAGE_SIZE - alloc::MemoryAllocator::PAGE_SIZE;
+    void * reserved = mmap(nullptr, reserved_sz, prot, flags, -1, 0);
+    if (reserved == MAP_FAILED) {
+        return reserved;
+    }
+    char * start = static_cast<char *>(reserved);
+    char * aligned = reinterpret_cast<char *>(alloc::MemoryAllocator::roundUpToHugePages(reinterpret_cast<uintptr_t>(start)));
+    size_t head = aligned - start;
+    size_t tail = reserved_sz - head - sz;
+    if (head > 0) {
+        munmap(start, head);
+    }
+    if (tail > 0) {
+        munmap(aligned + sz, tail);
+    }
+    return aligned;
+}
+
 size_t sum(const MMapStore & s)
 {
     size_t sum(0);
@@ -345,7 +373,11 @@ MMapAllocator::salloc(size_t sz, void * wantedAddress)
             stackTrace = getStackTrace(1);
             LOG(info, "mmap %ld of size %ld from %s", mmapId, sz, stackTrace.c_str());
         }
-        buf = mmap(wantedAddress, sz, prot, flags | _g_HugeFlags, -1, 0);
+        if ((_g_HugeFlags == 0) && (wantedAddress == nullptr) && (sz >= _g_MMapHugePageAlignLimit)) {
+            buf = mmap_huge_page_aligned(sz, prot, flags);
+        } else {
+            buf = mmap(wantedAddress, sz, prot, flags | _g_HugeFlags, -1, 0);
+        }
         if (buf == MAP_FAILED) {
             if ( ! load_relaxed(_g_hasHugePageFailureJustHappened)) {
                 store_relaxed(_g_hasHugePageFailureJustHappened, true);
@@ -60,10 +60,12 @@ Signal::Signal() noexcept
 {}
 Signal::~Signal() = default;
 
-SimpleThreadBundle::Pool::Pool(size_t bundleSize, init_fun_t init_fun)
+SimpleThreadBundle::Pool::Pool(size_t bundleSize, init_fun_t init_fun, size_t maxBundles)
     : _lock(),
       _bundleSize(bundleSize),
       _init_fun(init_fun),
+      _maxBundles(maxBundles),
+      _numObtained(0),
       _bundles()
 {
 }
@@ -81,6 +83,25 @@ SimpleThreadBundle::Pool::obtain()
 {
     {
         std::lock_guard guard(_lock);
+        ++_numObtained;
+        if (!_bundles.empty()) {
+            SimpleThreadBundle::UP ret(_bundles.back());
+            _bundles.pop_back();
+            return ret;
+        }
+    }
+    return std::make_unique<SimpleThreadBundle>(_bundleSize, _init_fun, USE_SIGNAL_LIST);
+}
+
+SimpleThreadBundle::UP
+SimpleThreadBundle::Pool::try_obtain()
+{
+    {
+        std::lock_guard guard(_lock);
+        if ((_maxBundles != 0) && (_numObtained >= _maxBundles)) {
+            return {};
+        }
+        ++_numObtained;
         if (!_bundles.empty()) {
             SimpleThreadBundle::UP ret(_bundles.back());
             _bundles.pop_back();
@@ -94,6 +115,7 @@ void
 SimpleThreadBundle::Pool::release(SimpleThreadBundle::UP bundle)
 {
     std::lock_guard guard(_lock);
+    --_numObtained;
     _bundles.push_back(bundle.get());
     bundle.release();
 }
@@ -100,6 +100,8 @@ public:
         std::mutex _lock;
         size_t     _bundleSize;
         init_fun_t _init_fun;
+        size_t     _maxBundles; // 0 means no limit
+        size_t     _numObtained;
         std::vector<SimpleThreadBundle*> _bundles;
 
     public:
@@ -114,12 +116,15 @@ public:
             SimpleThreadBundle::UP  _bundle;
             Pool                   &_pool;
         };
-        Pool(size_t bundleSize, init_fun_t init_fun);
+        Pool(size_t bundleSize, init_fun_t init_fun, size_t maxBundles);
+        Pool(size_t bundleSize, init_fun_t init_fun) : Pool(bundleSize, std::move(init_fun), 0) {}
         explicit Pool(size_t bundleSize) : Pool(bundleSize, Runnable::default_init_function) {}
         ~Pool();
         Guard getBundle() { return Guard(*this); }
         //TODO Make private
         SimpleThreadBundle::UP obtain();
+        // Like obtain, but returns nullptr if maxBundles bundles are already handed out.
+        SimpleThreadBundle::UP try_obtain();
         void release(SimpleThreadBundle::UP bundle);
     };
 
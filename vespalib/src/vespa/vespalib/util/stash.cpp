@@ -56,6 +56,7 @@ Stash::do_alloc(size_t size)
         size_t allocate = sizeof(stash::DeleteMemory) + size;
         char *mem = static_cast<char*>(malloc(allocate));
         _cleanup = new (mem) stash::DeleteMemory(allocate, _cleanup);
+        _large_used += allocate;
         return (mem + sizeof(stash::DeleteMemory));
     }
 }
@@ -63,17 +64,20 @@ Stash::do_alloc(size_t size)
 Stash::Stash(size_t chunk_size) noexcept
     : _chunks(nullptr),
       _cleanup(nullptr),
-      _chunk_size(std::max(size_t(128), chunk_size))
+      _chunk_size(std::max(size_t(128), chunk_size)),
+      _large_used(0)
 {
 }
 
 Stash::Stash(Stash &&rhs) noexcept
     : _chunks(rhs._chunks),
       _cleanup(rhs._cleanup),
-      _chunk_size(rhs._chunk_size)
+      _chunk_size(rhs._chunk_size),
+      _large_used(rhs._large_used)
 {
     rhs._chunks = nullptr;
     rhs._cleanup = nullptr;
+    rhs._large_used = 0;
 }
 
 Stash &
@@ -84,8 +88,10 @@ Stash::operator=(Stash &&rhs) noexcept
     _chunks = rhs._chunks;
     _cleanup = rhs._cleanup;
     _chunk_size = rhs._chunk_size;
+    _large_used = rhs._large_used;
     rhs._chunks = nullptr;
     rhs._cleanup = nullptr;
+    rhs._large_used = 0;
     return *this;
 }
 
@@ -100,6 +106,7 @@ Stash::clear()
 {
     _cleanup = stash::run_cleanup(_cleanup);
     _chunks = stash::keep_one(_chunks);
+    _large_used = 0;
 }
 
 void
@@ -110,6 +117,7 @@ Stash::revert(const Mark &mark)
     if (_chunks != nullptr) {
         _chunks->used = mark._used;
     }
+    _large_used = mark._large_used;
 }
 
 size_t
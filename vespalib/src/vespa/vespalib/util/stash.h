@@ -87,6 +87,7 @@ private:
     stash::Chunk   *_chunks;
     stash::Cleanup *_cleanup;
     size_t          _chunk_size;
+    size_t          _large_used; // bytes in objects allocated separately
 
     char *do_alloc(size_t size);
     bool is_small(size_t size) const noexcept { return (size < (_chunk_size / 4)); }
@@ -124,10 +125,11 @@ public:
         stash::Cleanup *_cleanup;
         stash::Chunk   *_chunk;
         size_t          _used;
-        Mark(stash::Cleanup *cleanup, stash::Chunk *chunk) noexcept
-            : _cleanup(cleanup), _chunk(chunk), _used(chunk ? chunk->used : 0u) {}
+        size_t          _large_used;
+        Mark(stash::Cleanup *cleanup, stash::Chunk *chunk, size_t large_used) noexcept
+            : _cleanup(cleanup), _chunk(chunk), _used(chunk ? chunk->used : 0u), _large_used(large_used) {}
     public:
-        Mark() noexcept : Mark(nullptr, nullptr) {}
+        Mark() noexcept : Mark(nullptr, nullptr, 0) {}
     };
 
     using UP = std::unique_ptr<Stash>;
@@ -142,10 +144,13 @@ public:
 
     void clear();
 
-    Mark mark() const noexcept { return Mark(_cleanup, _chunks); }
+    Mark mark() const noexcept { return Mark(_cleanup, _chunks, _large_used); }
     void revert(const Mark &mark);
 
     size_t count_used() const;
+    // used bytes including objects allocated separately; cheaper than
+    // get_memory_usage since only chunks are visited
+    size_t count_used_including_large() const { return count_used() + _large_used; }
     size_t get_chunk_size() const { return _chunk_size; }
     MemoryUsage get_memory_usage() const;
 
@@ -0,0 +1,156 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+/**
+ * Measures how fast threads pinned to different NUMA nodes can use memory they allocate.
+ *
+ * local:  Each thread allocates, writes, reads and frees its own buffers.
+ * remote: Threads are paired across NUMA nodes. Each round a thread frees the buffers
+ *         allocated by its partner and then allocates and uses new buffers. Without NUMA
+ *         aware pools, the new buffers are likely to be memory homed on the other node.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sched.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr size_t buffer_size = 4000;
+constexpr size_t buffers_per_round = 4096;
+constexpr size_t passes_per_round = 8;
+
+std::vector<int>
+cpus_of_node(int node) {
+    std::vector<int> cpus;
+    char name[128];
+    snprintf(name, sizeof(name), "/sys/devices/system/node/node%d/cpulist", node);
+    int fd = open(name, O_RDONLY);
+    if (fd < 0) {
+        return cpus;
+    }
+    char buf[1024];
+    ssize_t sz = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    buf[std::max(sz, ssize_t(0))] = '\0';
+    for (char * p = buf; *p; ) {
+        int first = strtol(p, &p, 10);
+        int last = first;
+        if (*p == '-') {
+            last = strtol(p + 1, &p, 10);
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+        while (*p && ((*p == ',') || (*p == '\n'))) {
+            ++p;
+        }
+    }
+    return cpus;
+}
+
+void
+pin_to(const std::vector<int> & cpus) {
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+}
+
+uint64_t
+use(std::vector<char *> & buffers, uint8_t value) {
+    uint64_t sum = 0;
+    for (size_t pass = 0; pass < passes_per_round; ++pass) {
+        for (char * buf : buffers) {
+            memset(buf, value + pass, buffer_size);
+            for (size_t i = 0; i < buffer_size; i += 64) {
+                sum += uint8_t(buf[i]);
+            }
+        }
+    }
+    return sum;
+}
+
+double
+run(bool remote, size_t num_threads, size_t num_rounds, const std::vector<std::vector<int>> & node_cpus) {
+    std::vector<std::vector<char *>> buffers(num_threads);
+    std::barrier sync(num_threads);
+    std::atomic<uint64_t> checksum(0);
+    auto worker = [&](size_t thread_id) {
+        pin_to(node_cpus[thread_id % node_cpus.size()]);
+        sync.arrive_and_wait(); // every thread is now running on its node
+        uint64_t sum = 0;
+        for (size_t round = 0; round < num_rounds; ++round) {
+            // In remote mode, free the buffers allocated by the partner thread on the other node.
+            size_t owner = remote ? (thread_id ^ 1) : thread_id;
+            if (round > 0) {
+                sync.arrive_and_wait();
+                for (char * buf : buffers[owner]) {
+                    free(buf);
+                }
+                sync.arrive_and_wait();
+            }
+            std::vector<char *> & mine = buffers[thread_id];
+            mine.clear();
+            for (size_t i = 0; i < buffers_per_round; ++i) {
+                mine.push_back(static_cast<char *>(malloc(buffer_size)));
+            }
+            sum += use(mine, round);
+        }
+        checksum += sum;
+    };
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    for (auto & t : threads) {
+        t.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (auto & list : buffers) {
+        for (char * buf : list) {
+            free(buf);
+        }
+    }
+    fprintf(stderr, "(checksum %lu)\n", checksum.load());
+    return seconds;
+}
+
+}
+
+int main(int argc, char **argv) {
+    size_t num_threads = (argc > 1) ? strtoul(argv[1], nullptr, 0) : 8;
+    size_t num_rounds = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 50;
+    num_threads = std::max(size_t(2), num_threads & ~size_t(1)); // threads are paired
+    std::vector<std::vector<int>> node_cpus;
+    for (int node = 0; ; ++node) {
+        auto cpus = cpus_of_node(node);
+        if (cpus.empty()) {
+            break;
+        }
+        node_cpus.push_back(std::move(cpus));
+    }
+    if (node_cpus.empty()) {
+        node_cpus.emplace_back();
+    }
+    // Paired threads (2k, 2k+1) are placed on different nodes when there are several.
+    fprintf(stdout, "%zu NUMA nodes, %zu threads, %zu rounds, numa pools %s\n",
+            node_cpus.size(), num_threads, num_rounds, getenv("VESPA_MALLOC_NUMA_POOLS") ? "on" : "off");
+    fprintf(stdout, "local:  %8.3f s\n", run(false, num_threads, num_rounds, node_cpus));
+    fprintf(stdout, "remote: %8.3f s\n", run(true, num_threads, num_rounds, node_cpus));
+    return 0;
+}
@@ -0,0 +1,8 @@
+#!/bin/bash
+# Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+set -e
+
+VESPA_MALLOC_SO=../../../src/vespamalloc/libvespamalloc.so
+
+LD_PRELOAD=$VESPA_MALLOC_SO ./vespamalloc_numa_benchmark_app 16 50
+VESPA_MALLOC_NUMA_POOLS=yes LD_PRELOAD=$VESPA_MALLOC_SO ./vespamalloc_numa_benchmark_app 16 50
@@ -0,0 +1,143 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include <vespa/vespalib/gtest/gtest.h>
+#include <vespamalloc/malloc/heapprofiler.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using vespamalloc::HeapProfiler;
+
+namespace {
+
+std::string
+dump(const HeapProfiler & profiler) {
+    char * buf = nullptr;
+    size_t len = 0;
+    FILE * os = open_memstream(&buf, &len);
+    profiler.dump(os);
+    fclose(os);
+    std::string result(buf, len);
+    free(buf);
+    return result;
+}
+
+// A stream that touches the profiler on every write, like a stream that reallocs a sampled buffer does.
+struct ReentrantSink {
+    HeapProfiler & profiler;
+    int            obj;
+    size_t         writes;
+};
+
+ssize_t
+reentrant_write(void * cookie, const char *, size_t size) {
+    auto & sink = *static_cast<ReentrantSink *>(cookie);
+    sink.profiler.record(&sink.obj, 1);
+    sink.profiler.release(&sink.obj);
+    sink.writes++;
+    return size;
+}
+
+}
+
+TEST(HeapProfilerTest, disabled_by_default) {
+    HeapProfiler profiler;
+    EXPECT_FALSE(profiler.enabled());
+    EXPECT_FALSE(profiler.hasSamples());
+}
+
+TEST(HeapProfilerTest, sample_count_down_is_positive_and_averages_to_interval) {
+    HeapProfiler profiler;
+    profiler.setup(0x10000, 16);
+    ASSERT_TRUE(profiler.enabled());
+    uint64_t rng = 0x1234567;
+    double sum = 0;
+    constexpr size_t N = 100000;
+    for (size_t i = 0; i < N; i++) {
+        int64_t countDown = profiler.nextSampleCountDown(rng);
+        ASSERT_GT(countDown, 0);
+        sum += countDown;
+    }
+    EXPECT_NEAR(double(0x10000), sum/N, 0x10000 * 0.05);
+}
+
+TEST(HeapProfilerTest, samples_are_recorded_until_released) {
+    HeapProfiler profiler;
+    profiler.setup(0x1000, 16);
+    int a, b;
+    profiler.record(&a, 100);
+    profiler.record(&b, 200);
+    EXPECT_TRUE(profiler.hasSamples());
+    std::string profile = dump(profiler);
+    EXPECT_EQ(0u, profile.find("heap profile: 2: 300 [2: 300] @ heap_v2/4096\n"));
+    EXPECT_NE(std::string::npos, profile.find("1: 100 [1: 100] @ 0x"));
+    EXPECT_NE(std::string::npos, profile.find("1: 200 [1: 200] @ 0x"));
+    EXPECT_NE(std::string::npos, profile.find("\nMAPPED_LIBRARIES:\n"));
+
+    profiler.release(&a);
+    profile = dump(profiler);
+    EXPECT_EQ(0u, profile.find("heap profile: 1: 200 [1: 200] @ heap_v2/4096\n"));
+    EXPECT_EQ(std::string::npos, profile.find("1: 100 [1: 100] @ 0x"));
+    profiler.release(&b);
+    EXPECT_FALSE(profiler.hasSamples());
+}
+
+TEST(HeapProfilerTest, samples_beyond_capacity_are_dropped) {
+    HeapProfiler profiler;
+    profiler.setup(0x1000, 4);
+    char objs[16];
+    for (char & obj : objs) {
+        profiler.record(&obj, 1);
+    }
+    std::string profile = dump(profiler);
+    size_t numSamples = std::strtoul(profile.c_str() + strlen("heap profile: "), nullptr, 10);
+    EXPECT_EQ(4u, numSamples);
+    for (char & obj : objs) {
+        profiler.release(&obj);
+    }
+    EXPECT_FALSE(profiler.hasSamples());
+}
+
+TEST(HeapProfilerTest, profiler_can_be_used_while_writing_dump) {
+    HeapProfiler profiler;
+    profiler.setup(0x1000, 16);
+    int a;
+    profiler.record(&a, 100);
+    ReentrantSink sink{profiler, 0, 0};
+    FILE * os = fopencookie(&sink, "w", {nullptr, reentrant_write, nullptr, nullptr});
+    ASSERT_NE(nullptr, os);
+    setvbuf(os, nullptr, _IONBF, 0);
+    profiler.dump(os);
+    fclose(os);
+    EXPECT_LT(0u, sink.writes);
+    EXPECT_EQ(0u, dump(profiler).find("heap profile: 1: 100 [1: 100] @ heap_v2/4096\n"));
+    profiler.release(&a);
+    EXPECT_FALSE(profiler.hasSamples());
+}
+
+TEST(HeapProfilerTest, filter_finds_all_live_samples_and_few_others) {
+    HeapProfiler profiler;
+    std::vector<char> objs(0x10000);
+    EXPECT_FALSE(profiler.maybeSampled(&objs[0]));
+    profiler.setup(0x1000, 64);
+    for (size_t i = 0; i < 64; i++) {
+        profiler.record(&objs[i * 16], 1);
+    }
+    for (size_t i = 0; i < 64; i++) {
+        EXPECT_TRUE(profiler.maybeSampled(&objs[i * 16]));
+    }
+    size_t falsePositives = 0;
+    for (size_t i = 64; i < objs.size() / 16; i++) {
+        falsePositives += profiler.maybeSampled(&objs[i * 16]) ? 1 : 0;
+    }
+    EXPECT_LT(falsePositives, objs.size() / 16 / 8);
+    for (size_t i = 0; i < 64; i++) {
+        profiler.release(&objs[i * 16]);
+    }
+    EXPECT_FALSE(profiler.hasSamples());
+    for (size_t i = 0; i < objs.size() / 16; i++) {
+        EXPECT_FALSE(profiler.maybeSampled(&objs[i * 16]));
+    }
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "datasegment.h"
+#include <vespamalloc/util/numa.h>
 #include <algorithm>
 #include <unistd.h>
 
@@ -10,6 +11,20 @@ DataSegment::~DataSegment() = default;
 
 #define INIT_LOG_LIMIT 0x400000000ul // 16G
 
+namespace {
+
+uint32_t
+numaNodesToUse()
+{
+    const char * numaPools = getenv("VESPA_MALLOC_NUMA_POOLS");
+    if ((numaPools != nullptr) && (strcmp(numaPools, "no") != 0) && (strcmp(numaPools, "0") != 0)) {
+        return numa::numNodes();
+    }
+    return 1;
+}
+
+}
+
 DataSegment::DataSegment(const IHelper & helper) :
     _osMemory(BlockSize),
     _bigSegmentLogLevel(0),
@@ -18,6 +33,7 @@ DataSegment::DataSegment(const IHelper & helper) :
     _unmapSize(0x100000),
     _nextLogLimit(INIT_LOG_LIMIT),
     _partialExtension(0),
+    _numaNodes(numaNodesToUse()),
     _helper(helper),
     _mutex(),
     _freeList(_blockList),
@@ -44,13 +60,14 @@ DataSegment::freeSize() const {
 }
 
 void *
-DataSegment::getBlock(size_t & oldBlockSize, SizeClassT sc)
+DataSegment::getBlock(size_t & oldBlockSize, SizeClassT sc, uint32_t numaNode)
 {
     const size_t minBlockSize = std::max(BlockSize, _osMemory.getMinBlockSize());
     oldBlockSize = ((oldBlockSize + (minBlockSize-1))/minBlockSize)*minBlockSize;
     BlockIdT numBlocks((oldBlockSize + (BlockSize - 1)) / BlockSize);
     size_t blockSize = BlockSize * numBlocks;
     void * newBlock;
+    bool reused(false);
     {
         Guard sync(_mutex);
         newBlock = _freeList.sub(numBlocks);
@@ -77,6 +94,7 @@ DataSegment::getBlock(size_t & oldBlockSize, SizeClassT sc)
                 (void) result;
             }
         } else {
+            reused = true;
             DEBUG(fprintf(stderr, "Reuse segment %p(%d, %d)\n", newBlock, sc, numBlocks));
         }
     }
@@ -87,6 +105,8 @@ DataSegment::getBlock(size_t & oldBlockSize, SizeClassT sc)
         blockSize = 0;
     } else {
         ASSERT_STACKTRACE(blockId(newBlock)+numBlocks < BlockCount);
+        // A reused block keeps its pages, so they must follow it when another node takes it over.
+        const bool moveExisting = reused && (_blockList[blockId(newBlock)].numaNode() != numaNode);
         // assumes _osMemory.get will always return a value that does not make
         // "i" overflow the _blockList array; this will break when hitting the
         // 2T address space boundary.
@@ -94,6 +114,10 @@ DataSegment::getBlock(size_t & oldBlockSize, SizeClassT sc)
             _blockList[i].sizeClass(sc);
             _blockList[i].freeChainLength(m-i);
             _blockList[i].realNumBlocks(m-i);
+            _blockList[i].numaNode(numaNode);
+        }
+        if (_numaNodes > 1) {
+            numa::preferNode(newBlock, blockSize, numaNode, moveExisting);
         }
     }
     oldBlockSize = blockSize;
@@ -276,8 +300,8 @@ size_t DataSegment::infoThread(FILE * os, int level, uint32_t thread, SizeClassT
 void
 DataSegment::info(FILE * os, size_t level)
 {
-    fprintf(os, "Start at %p, End at %p(%p) size(%ld) partialExtension(%ld) NextLogLimit(%lx) logLevel(%ld)\n",
-            _osMemory.getStart(), _osMemory.getEnd(), sbrk(0), dataSize(), _partialExtension, _nextLogLimit, level);
+    fprintf(os, "Start at %p, End at %p(%p) size(%ld) partialExtension(%ld) NextLogLimit(%lx) logLevel(%ld) numaNodes(%u)\n",
+            _osMemory.getStart(), _osMemory.getEnd(), sbrk(0), dataSize(), _partialExtension, _nextLogLimit, level, _numaNodes);
     size_t numAllocatedBlocks(0);
     size_t numFreeBlocks = _freeList.numFreeBlocks();
     _freeList.info(os);
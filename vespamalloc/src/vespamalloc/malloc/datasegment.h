@@ -33,9 +33,12 @@ public:
     explicit DataSegment(const IHelper & helper) __attribute__((noinline));
     ~DataSegment() __attribute__((noinline));
 
-    void * getBlock(size_t & oldBlockSize, SizeClassT sc) __attribute__((noinline));
+    void * getBlock(size_t & oldBlockSize, SizeClassT sc, uint32_t numaNode = 0) __attribute__((noinline));
     void returnBlock(void *ptr) __attribute__((noinline));
     SizeClassT sizeClass(const void * ptr)    const { return _blockList[blockId(ptr)].sizeClass(); }
+    uint32_t numaNode(const void * ptr)       const { return _blockList[blockId(ptr)].numaNode(); }
+    /// Number of NUMA nodes with separate pools, 1 unless enabled with VESPA_MALLOC_NUMA_POOLS.
+    uint32_t numaNodes()                      const { return _numaNodes; }
     bool containsPtr(const void * ptr)        const { return blockId(ptr) < BlockCount; }
     template<typename MemBlockPtrT>
     size_t getMaxSize(const void * ptr)       const { return _blockList[blockId(ptr)].getMaxSize<MemBlockPtrT>(); }
@@ -71,6 +74,7 @@ private:
     size_t          _unmapSize;
     size_t          _nextLogLimit;
     size_t          _partialExtension;
+    uint32_t        _numaNodes;
     const IHelper  &_helper;
 
     Mutex           _mutex;
@@ -40,14 +40,16 @@ class BlockT
 {
 public:
     BlockT(SizeClassT szClass = UNUSED_BLOCK, BlockIdT numBlocks = 0)
-        : _sizeClass(szClass), _freeChainLength(0), _realNumBlocks(numBlocks)
+        : _sizeClass(szClass), _freeChainLength(0), _realNumBlocks(numBlocks), _numaNode(0)
     { }
     SizeClassT sizeClass()            const { return _sizeClass; }
     BlockIdT realNumBlocks()          const { return _realNumBlocks; }
     BlockIdT freeChainLength()        const { return _freeChainLength; }
+    uint32_t numaNode()               const { return _numaNode; }
     void sizeClass(SizeClassT sc)           { _sizeClass = sc; }
     void realNumBlocks(BlockIdT fc)         { _realNumBlocks = fc; }
     void freeChainLength(BlockIdT fc)       { _freeChainLength = fc; }
+    void numaNode(uint32_t node)            { _numaNode = node; }
     template<typename MemBlockPtrT>
     size_t getMaxSize()               const {
         return MemBlockPtrT::unAdjustSize(std::min(MemBlockPtrT::classSize(_sizeClass),
@@ -59,6 +61,8 @@ private:
     BlockIdT _freeChainLength;
     /// Real number of blocks used. Used to avoid rounding for big blocks.
     BlockIdT _realNumBlocks;
+    /// The NUMA node this block was last handed out for.
+    uint8_t  _numaNode;
 };
 
 template <int MaxCount>
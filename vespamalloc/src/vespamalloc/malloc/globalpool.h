@@ -4,6 +4,7 @@
 #include "common.h"
 #include "allocchunk.h"
 #include "datasegment.h"
+#include <vespamalloc/util/numa.h>
 #include <algorithm>
 
 #define USE_STAT2(a) a
@@ -21,13 +22,18 @@ public:
     AllocPoolT & operator = (const AllocPoolT & ap) = delete;
     ~AllocPoolT();
 
+    // Lists of free memory are kept separately for each NUMA node the memory was handed out for.
+    // Empty lists carry no memory and are shared.
     ChunkSList *getFree(SizeClassT sc, size_t minBlocks);
-    ChunkSList *exchangeFree(SizeClassT sc, ChunkSList * csl);
-    ChunkSList *exchangeAlloc(SizeClassT sc, ChunkSList * csl);
-    ChunkSList *exactAlloc(size_t exactSize, SizeClassT sc, ChunkSList * csl) __attribute__((noinline));
+    ChunkSList *exchangeFree(SizeClassT sc, ChunkSList * csl, uint32_t numaNode);
+    ChunkSList *exchangeAlloc(SizeClassT sc, ChunkSList * csl, uint32_t numaNode);
+    ChunkSList *exactAlloc(size_t exactSize, SizeClassT sc, ChunkSList * csl, uint32_t numaNode) __attribute__((noinline));
     ChunkSList *returnMemory(SizeClassT sc, ChunkSList * csl) __attribute__((noinline));
 
     DataSegment & dataSegment()      { return _dataSegment; }
+    uint32_t numaNodeOfCurrentThread() const {
+        return (_dataSegment.numaNodes() > 1) ? (numa::currentNode() % _dataSegment.numaNodes()) : 0;
+    }
     void enableThreadSupport() __attribute__((noinline));
 
     static void setParams(size_t threadCacheLimit);
@@ -38,8 +44,8 @@ public:
     void info(FILE * os, size_t level=0) __attribute__((noinline));
 private:
     ChunkSList * getFree(SizeClassT sc) __attribute__((noinline));
-    ChunkSList * getAlloc(SizeClassT sc) __attribute__((noinline));
-    ChunkSList * malloc(const Guard & guard, SizeClassT sc) __attribute__((noinline));
+    ChunkSList * getAlloc(SizeClassT sc, uint32_t numaNode) __attribute__((noinline));
+    ChunkSList * malloc(const Guard & guard, SizeClassT sc, uint32_t numaNode) __attribute__((noinline));
     ChunkSList * getChunks(const Guard & guard, size_t numChunks) __attribute__((noinline));
     ChunkSList * allocChunkList(const Guard & guard) __attribute__((noinline));
     void validate(const void * ptr) const noexcept;
@@ -48,7 +54,7 @@ private:
     {
     public:
         AllocFree() : _full(), _empty() { }
-        typename ChunkSList::AtomicHeadPtr _full;
+        typename ChunkSList::AtomicHeadPtr _full[numa::MAX_NODES];
         typename ChunkSList::AtomicHeadPtr _empty;
     };
     class Stat
@@ -62,14 +62,14 @@ AllocPoolT<MemBlockPtrT>::getFree(SizeClassT sc)
 
 template <typename MemBlockPtrT>
 typename AllocPoolT<MemBlockPtrT>::ChunkSList *
-AllocPoolT<MemBlockPtrT>::getAlloc(SizeClassT sc)
+AllocPoolT<MemBlockPtrT>::getAlloc(SizeClassT sc, uint32_t numaNode)
 {
     ChunkSList * csl(nullptr);
-    typename ChunkSList::AtomicHeadPtr & full = _scList[sc]._full;
+    typename ChunkSList::AtomicHeadPtr & full = _scList[sc]._full[numaNode];
     while ((csl = ChunkSList::linkOut(full)) == nullptr) {
         Guard sync(_mutex);
         if (full.load(std::memory_order_relaxed)._ptr == nullptr) {
-            ChunkSList * ncsl(malloc(sync, sc));
+            ChunkSList * ncsl(malloc(sync, sc, numaNode));
             if (ncsl) {
                 ChunkSList::linkInList(full, ncsl);
             } else {
@@ -94,12 +94,13 @@ AllocPoolT<MemBlockPtrT>::getFree(SizeClassT sc, size_t UNUSED(minBlocks))
 
 template <typename MemBlockPtrT>
 typename AllocPoolT<MemBlockPtrT>::ChunkSList *
-AllocPoolT<MemBlockPtrT>::exchangeFree(SizeClassT sc, typename AllocPoolT<MemBlockPtrT>::ChunkSList * csl)
+AllocPoolT<MemBlockPtrT>::exchangeFree(SizeClassT sc, typename AllocPoolT<MemBlockPtrT>::ChunkSList * csl,
+                                       uint32_t numaNode)
 {
     PARANOID_CHECK1( if (csl->empty() || (csl->count() > ChunkSList::NumBlocks)) { *(int*)0 = 0; } );
     AllocFree & af = _scList[sc];
-    validate(af._full.load(std::memory_order_relaxed)._ptr);
-    ChunkSList::linkIn(af._full, csl, csl);
+    validate(af._full[numaNode].load(std::memory_order_relaxed)._ptr);
+    ChunkSList::linkIn(af._full[numaNode], csl, csl);
     ChunkSList *ncsl = getFree(sc);
     validate(ncsl);
     USE_STAT2(_stat[sc]._exchangeFree.fetch_add(1, std::memory_order_relaxed));
@@ -108,13 +109,14 @@ AllocPoolT<MemBlockPtrT>::exchangeFree(SizeClassT sc, typename AllocPoolT<MemBlo
 
 template <typename MemBlockPtrT>
 typename AllocPoolT<MemBlockPtrT>::ChunkSList *
-AllocPoolT<MemBlockPtrT>::exchangeAlloc(SizeClassT sc, typename AllocPoolT<MemBlockPtrT>::ChunkSList * csl)
+AllocPoolT<MemBlockPtrT>::exchangeAlloc(SizeClassT sc, typename AllocPoolT<MemBlockPtrT>::ChunkSList * csl,
+                                        uint32_t numaNode)
 {
     PARANOID_CHECK1( if ( ! csl->empty()) { *(int*)0 = 0; } );
     AllocFree & af = _scList[sc];
     validate(af._empty.load(std::memory_order_relaxed)._ptr);
     ChunkSList::linkIn(af._empty, csl, csl);
-    ChunkSList * ncsl = getAlloc(sc);
+    ChunkSList * ncsl = getAlloc(sc, numaNode);
     validate(ncsl);
     USE_STAT2(_stat[sc]._exchangeAlloc.fetch_add(1, std::memory_order_relaxed));
     PARANOID_CHECK1( if (ncsl->empty() || (ncsl->count() > ChunkSList::NumBlocks)) { *(int*)0 = 0; } );
@@ -130,10 +132,10 @@ AllocPoolT<MemBlockPtrT>::validate(const void * ptr) const noexcept {
 template <typename MemBlockPtrT>
 typename AllocPoolT<MemBlockPtrT>::ChunkSList *
 AllocPoolT<MemBlockPtrT>::exactAlloc(size_t exactSize, SizeClassT sc,
-                                     typename AllocPoolT<MemBlockPtrT>::ChunkSList * csl)
+                                     typename AllocPoolT<MemBlockPtrT>::ChunkSList * csl, uint32_t numaNode)
 {
     size_t adjustedSize = computeExactSize(exactSize);
-    void *exactBlock = _dataSegment.getBlock(adjustedSize, sc);
+    void *exactBlock = _dataSegment.getBlock(adjustedSize, sc, numaNode);
     MemBlockPtrT mem(exactBlock, MemBlockPtrT::unAdjustSize(adjustedSize));
     csl->add(mem);
     ChunkSList * ncsl = csl;
@@ -149,7 +151,7 @@ AllocPoolT<MemBlockPtrT>::returnMemory(SizeClassT sc, typename AllocPoolT<MemBlo
 {
     ChunkSList * completelyEmpty(nullptr);
 #if 0
-    completelyEmpty = exchangeFree(sc, csl);
+    completelyEmpty = exchangeFree(sc, csl, 0);
 #else
     for(; !csl->empty(); ) {
         MemBlockPtrT mem;
@@ -165,14 +167,14 @@ AllocPoolT<MemBlockPtrT>::returnMemory(SizeClassT sc, typename AllocPoolT<MemBlo
 
 template <typename MemBlockPtrT>
 typename AllocPoolT<MemBlockPtrT>::ChunkSList *
-AllocPoolT<MemBlockPtrT>::malloc(const Guard & guard, SizeClassT sc)
+AllocPoolT<MemBlockPtrT>::malloc(const Guard & guard, SizeClassT sc, uint32_t numaNode)
 {
     const size_t numShifts =
         (sc <= MemBlockPtrT::SizeClassSpan) ? (MemBlockPtrT::SizeClassSpan - sc) : 0;
     size_t numBlocks = 1 << numShifts;
     const size_t cs(MemBlockPtrT::classSize(sc));
     size_t blockSize = cs * numBlocks;
-    void * block = _dataSegment.getBlock(blockSize, sc);
+    void * block = _dataSegment.getBlock(blockSize, sc, numaNode);
     ChunkSList * csl(nullptr);
     if (block != nullptr) {
         numBlocks = (blockSize + cs - 1)/cs;
@@ -0,0 +1,200 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include "heapprofiler.h"
+#include "common.h"
+#include <cmath>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace vespamalloc {
+
+namespace {
+
+// Frames for record() and the allocator itself are not interesting.
+constexpr int SKIP_FRAMES = 3;
+// Filter counters per hash table slot, so free() of an unsampled pointer rarely has to look in the table.
+constexpr size_t FILTER_FACTOR = 8;
+
+}
+
+HeapProfiler::HeapProfiler()
+    : _sampleInterval(0),
+      _numSamples(0),
+      _numDropped(0),
+      _mutex(),
+      _dumpMutex(),
+      _samples(nullptr),
+      _snapshot(nullptr),
+      _filter(nullptr),
+      _capacity(0),
+      _shift(64),
+      _filterShift(64)
+{ }
+
+HeapProfiler::~HeapProfiler() = default;
+
+void
+HeapProfiler::setup(size_t sampleInterval, size_t maxSamples)
+{
+    std::lock_guard guard(_mutex);
+    if ((sampleInterval > 0) && (_samples == nullptr)) {
+        // Keep the load factor at most 1/2, that is also the most the snapshot must hold.
+        size_t capacity = 2;
+        for (; capacity < maxSamples * 2; capacity *= 2) { }
+        const size_t tableSize = capacity * sizeof(Sample);
+        const size_t snapshotSize = (capacity / 2) * sizeof(Sample);
+        const size_t filterSize = capacity * FILTER_FACTOR * sizeof(FilterCount);
+        void * mem = ::mmap(nullptr, tableSize + snapshotSize + filterSize, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+        if (mem == MAP_FAILED) {
+            fprintf(_G_logFile, "Failed allocating heap profile of %zu samples, profiling disabled\n", maxSamples);
+            return;
+        }
+        _samples = static_cast<Sample *>(mem);
+        _snapshot = _samples + capacity;
+        _capacity = capacity;
+        _shift = 64 - msbIdx(capacity);
+        _filterShift = 64 - msbIdx(capacity * FILTER_FACTOR);
+        _filter.store(reinterpret_cast<FilterCount *>(_snapshot + capacity / 2), std::memory_order_release);
+    }
+    _sampleInterval.store(sampleInterval, std::memory_order_relaxed);
+}
+
+int64_t
+HeapProfiler::nextSampleCountDown(uint64_t & randomState) const
+{
+    size_t interval = _sampleInterval.load(std::memory_order_relaxed);
+    if (interval == 0) {
+        return INT64_MAX;
+    }
+    // xorshift64, then uniform in (0, 1]
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    double u = double((randomState >> 11) + 1) * (1.0 / double(1ul << 53));
+    return int64_t(-std::log(u) * double(interval)) + 1;
+}
+
+bool
+HeapProfiler::full() const
+{
+    // _capacity is published by the release store of _filter.
+    return (_filter.load(std::memory_order_acquire) == nullptr) ||
+           (_numSamples.load(std::memory_order_relaxed) * 2 >= _capacity);
+}
+
+size_t
+HeapProfiler::find(const void * ptr) const
+{
+    size_t mask = _capacity - 1;
+    for (size_t pos = slot(ptr); ; pos = (pos + 1) & mask) {
+        if ((_samples[pos]._ptr == ptr) || (_samples[pos]._ptr == nullptr)) {
+            return pos;
+        }
+    }
+}
+
+void
+HeapProfiler::erase(size_t pos)
+{
+    // Backward shift deletion keeps probe sequences intact without tombstones.
+    size_t mask = _capacity - 1;
+    for (size_t next = (pos + 1) & mask; _samples[next]._ptr != nullptr; next = (next + 1) & mask) {
+        size_t home = slot(_samples[next]._ptr);
+        if (((next - home) & mask) >= ((next - pos) & mask)) {
+            _samples[pos] = _samples[next];
+            pos = next;
+        }
+    }
+    _samples[pos]._ptr = nullptr;
+}
+
+void
+HeapProfiler::record(const void * ptr, size_t sz)
+{
+    if (full()) {
+        _numDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    void * stack[MAX_STACK_DEPTH + SKIP_FRAMES];
+    int depth = backtrace(stack, MAX_STACK_DEPTH + SKIP_FRAMES);
+    std::lock_guard guard(_mutex);
+    if (full()) {
+        _numDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Sample & s = _samples[find(ptr)];
+    if (s._ptr == nullptr) {
+        _numSamples.fetch_add(1, std::memory_order_relaxed);
+        _filter.load(std::memory_order_relaxed)[hash(ptr) >> _filterShift].fetch_add(1, std::memory_order_relaxed);
+    }
+    s._ptr = ptr;
+    s._size = sz;
+    s._depth = 0;
+    for (int i = SKIP_FRAMES; i < depth; i++) {
+        s._stack[s._depth++] = stack[i];
+    }
+}
+
+void
+HeapProfiler::release(const void * ptr)
+{
+    std::lock_guard guard(_mutex);
+    if (_samples != nullptr) {
+        size_t pos = find(ptr);
+        if (_samples[pos]._ptr != nullptr) {
+            erase(pos);
+            _numSamples.fetch_sub(1, std::memory_order_relaxed);
+            _filter.load(std::memory_order_relaxed)[hash(ptr) >> _filterShift].fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void
+HeapProfiler::dump(FILE * os) const
+{
+    // Writing may allocate and free, which can end up in record() and release().
+    // So only copy the samples while holding the lock, and write them afterwards.
+    std::lock_guard dumpGuard(_dumpMutex);
+    size_t count(0), bytes(0);
+    {
+        std::lock_guard guard(_mutex);
+        for (size_t i = 0; i < _capacity; i++) {
+            if (_samples[i]._ptr != nullptr) {
+                _snapshot[count++] = _samples[i];
+                bytes += _samples[i]._size;
+            }
+        }
+    }
+    fprintf(os, "heap profile: %zu: %zu [%zu: %zu] @ heap_v2/%zu\n",
+            count, bytes, count, bytes, _sampleInterval.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < count; i++) {
+        const Sample & s = _snapshot[i];
+        fprintf(os, "1: %zu [1: %zu] @", s._size, s._size);
+        for (uint32_t j = 0; j < s._depth; j++) {
+            fprintf(os, " %p", s._stack[j]);
+        }
+        fprintf(os, "\n");
+    }
+    // pprof needs the mappings to symbolize the addresses.
+    fprintf(os, "\nMAPPED_LIBRARIES:\n");
+    int fd = open("/proc/self/maps", O_RDONLY);
+    if (fd >= 0) {
+        char buf[4096];
+        for (ssize_t sz = read(fd, buf, sizeof(buf)); sz > 0; sz = read(fd, buf, sizeof(buf))) {
+            fwrite(buf, 1, sz, os);
+        }
+        close(fd);
+    }
+    fflush(os);
+}
+
+void
+HeapProfiler::info(FILE * os) const
+{
+    fprintf(os, "HeapProfiler sample interval %zu, %zu live samples, %zu dropped\n",
+            _sampleInterval.load(std::memory_order_relaxed), _numSamples.load(std::memory_order_relaxed),
+            _numDropped.load(std::memory_order_relaxed));
+}
+
+}
@@ -0,0 +1,73 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+
+namespace vespamalloc {
+
+/**
+ * Keeps a sampled profile of the live heap. On average one allocation is
+ * sampled for every 'sampleInterval' bytes allocated. For each sampled
+ * allocation the call stack is recorded until it is freed.
+ *
+ * The profile is written in the legacy (heap_v2) text format understood by
+ * pprof, which scales the samples back up using the sample interval.
+ *
+ * Sampled allocations are ordinary allocations. A small table of counters
+ * hashed on the pointer lets free() rule out nearly all unsampled pointers
+ * without taking the lock.
+ */
+class HeapProfiler {
+public:
+    static constexpr size_t MAX_STACK_DEPTH = 32;
+    HeapProfiler();
+    HeapProfiler(const HeapProfiler &) = delete;
+    HeapProfiler & operator =(const HeapProfiler &) = delete;
+    ~HeapProfiler();
+    /// Sample interval of 0 disables sampling. The sample table is sized on first enable.
+    void setup(size_t sampleInterval, size_t maxSamples);
+    bool enabled() const { return _sampleInterval.load(std::memory_order_relaxed) > 0; }
+    bool hasSamples() const { return _numSamples.load(std::memory_order_relaxed) > 0; }
+    /// False means that ptr is not sampled, true that it might be and release() must be called.
+    bool maybeSampled(const void * ptr) const {
+        const FilterCount * filter = _filter.load(std::memory_order_acquire);
+        return (filter != nullptr) && (filter[hash(ptr) >> _filterShift].load(std::memory_order_relaxed) != 0);
+    }
+    /// Number of bytes to allocate before the next sample, drawn from an exponential distribution.
+    int64_t nextSampleCountDown(uint64_t & randomState) const;
+    void record(const void * ptr, size_t sz) __attribute__((noinline));
+    void release(const void * ptr) __attribute__((noinline));
+    /// Writes the profile from a snapshot, so allocating and freeing while writing is fine.
+    void dump(FILE * os) const __attribute__((noinline));
+    void info(FILE * os) const;
+private:
+    using FilterCount = std::atomic<uint16_t>;
+    struct Sample {
+        const void * _ptr;
+        size_t       _size;
+        uint32_t     _depth;
+        const void * _stack[MAX_STACK_DEPTH];
+    };
+    static size_t hash(const void * ptr) { return (size_t(ptr) >> 4) * 0x9E3779B97F4A7C15ul; }
+    size_t slot(const void * ptr) const { return hash(ptr) >> _shift; }
+    bool full() const;
+    size_t find(const void * ptr) const;
+    void erase(size_t pos);
+
+    std::atomic<size_t>  _sampleInterval;
+    std::atomic<size_t>  _numSamples;
+    std::atomic<size_t>  _numDropped;
+    mutable std::mutex   _mutex;
+    mutable std::mutex   _dumpMutex; // Serializes use of _snapshot
+    Sample             * _samples;  // Open addressing hash table on the sampled pointer
+    Sample             * _snapshot; // Live samples copied out by dump, room for all of them
+    std::atomic<FilterCount *> _filter; // Live samples per hash of the pointer, set once by setup
+    size_t               _capacity;
+    uint32_t             _shift;
+    uint32_t             _filterShift;
+};
+
+}
@@ -43,6 +43,17 @@ void vespamalloc_dump_info(FILE* out_file) {
     vespamalloc::_GmemP->info(out_file, log_level);
 }
 
+// Exported symbol used by state explorer to fetch the sampled heap profile in pprof format.
+// Returns 0 and writes nothing if heap profiling is not enabled.
+int vespamalloc_dump_heap_profile(FILE* out_file) __attribute__((visibility("default")));
+int vespamalloc_dump_heap_profile(FILE* out_file) {
+    if ( ! vespamalloc::_GmemP->heapProfileEnabled()) {
+        return 0;
+    }
+    vespamalloc::_GmemP->dumpHeapProfile(out_file);
+    return 1;
+}
+
 }
 
 #include <vespamalloc/malloc/overload.h>
@@ -5,9 +5,11 @@
 #include "datasegment.h"
 #include "allocchunk.h"
 #include "globalpool.h"
+#include "heapprofiler.h"
 #include "threadpool.h"
 #include "threadlist.h"
 #include "threadproxy.h"
+#include <unistd.h>
 
 namespace vespamalloc {
 
@@ -53,26 +55,29 @@ public:
         if (_segment.containsPtr(ptr)) {
             freeSC(ptr, _segment.sizeClass(ptr));
         } else {
-            _mmapPool.unmap(MemBlockPtrT(ptr).rawPtr());
+            freeMMapped(ptr);
         }
     }
     void free(void *ptr, size_t sz) {
         if (_segment.containsPtr(ptr)) {
             freeSC(ptr, MemBlockPtrT::sizeClass(MemBlockPtrT::adjustSize(sz)));
         } else {
-            _mmapPool.unmap(MemBlockPtrT(ptr).rawPtr());
+            freeMMapped(ptr);
         }
     }
     void free(void *ptr, size_t sz, std::align_val_t alignment) {
         if (_segment.containsPtr(ptr)) {
             freeSC(ptr, MemBlockPtrT::sizeClass(MemBlockPtrT::adjustSize(sz, alignment)));
         } else {
-            _mmapPool.unmap(MemBlockPtrT(ptr).rawPtr());
+            freeMMapped(ptr);
         }
     }
     size_t getMinSizeForAlignment(size_t align, size_t sz) const { return MemBlockPtrT::getMinSizeForAlignment(align, sz); }
     size_t sizeClass(const void *ptr) const { return _segment.sizeClass(ptr); }
     size_t usable_size(void *ptr) const {
+        if ( ! _segment.containsPtr(ptr)) {
+            return MemBlockPtrT::unAdjustSize(_mmapPool.get_size(MemBlockPtrT(ptr).rawPtr()));
+        }
         return MemBlockPtrT::usable_size(ptr, _segment);
     }
 
@@ -96,17 +101,39 @@ public:
         _threadList.setParams(threadCacheLimit);
         _allocPool.setParams(threadCacheLimit);
     }
+    /**
+     * Sample about one allocation per sampleInterval bytes for the heap profile, 0 turns sampling off.
+     * Sampled allocations are ordinary allocations, free only asks the profiler's lock free filter.
+     */
+    void setupHeapProfile(size_t sampleInterval, size_t maxSamples, const char * dumpFile) {
+        _heapProfileFile = dumpFile;
+        _profiler.setup(sampleInterval, maxSamples);
+        _threadList.resetSampleCountDowns();
+    }
+    void dumpHeapProfile(FILE * os) const { _profiler.dump(os); }
+    /// Writes the heap profile to the configured file with .<pid>.<seq> appended.
+    void dumpHeapProfileToFile() __attribute__((noinline));
+    bool heapProfileEnabled() const { return _profiler.enabled(); }
     const DataSegment & dataSegment() const { return _segment; }
     const MMapPool & mmapPool() const { return _mmapPool; }
 private:
     void freeSC(void *ptr, SizeClassT sc);
+    void freeMMapped(void * ptr) {
+        if (_profiler.maybeSampled(ptr)) {
+            _profiler.release(ptr);
+        }
+        _mmapPool.unmap(MemBlockPtrT(ptr).rawPtr());
+    }
     void crash() __attribute__((noinline));
     using AllocPool = AllocPoolT<MemBlockPtrT>;
     using ThreadPool = typename ThreadListT::ThreadPool;
+    void * sampledMalloc(ThreadPool & tp, size_t sz) __attribute__((noinline));
     size_t       _prAllocLimit;
+    const char * _heapProfileFile;
     DataSegment  _segment;
     AllocPool    _allocPool;
     MMapPool     _mmapPool;
+    HeapProfiler _profiler;
     ThreadListT  _threadList;
 };
 
@@ -114,9 +141,11 @@ template <typename MemBlockPtrT, typename ThreadListT>
 MemoryManager<MemBlockPtrT, ThreadListT>::MemoryManager(size_t logLimitAtStart) :
     IAllocator(),
     _prAllocLimit(logLimitAtStart),
+    _heapProfileFile("vespamalloc.heap"),
     _segment(*this),
     _allocPool(_segment),
     _mmapPool(),
+    _profiler(),
     _threadList(_allocPool, _mmapPool)
 {
     setAllocatorForThreads(this);
@@ -172,6 +201,7 @@ void MemoryManager<MemBlockPtrT, ThreadListT>::info(FILE * os, size_t level)
     _allocPool.info(os, level);
     _threadList.info(os, level);
     _mmapPool.info(os, level);
+    _profiler.info(os);
     fflush(os);
 }
 
@@ -185,6 +215,12 @@ void * MemoryManager<MemBlockPtrT, ThreadListT>::malloc(size_t sz)
 {
     MemBlockPtrT mem;
     ThreadPool & tp = _threadList.getCurrent();
+    if (__builtin_expect(tp.countDownToSample(sz), false)) {
+        void * ptr = sampledMalloc(tp, sz);
+        if (ptr != nullptr) {
+            return ptr;
+        }
+    }
     tp.malloc(mem.adjustSize(sz), mem);
     if (!mem.validFree()) {
         fprintf(stderr, "Memory %p(%ld) has been tampered with after free.\n", mem.ptr(), mem.size());
@@ -210,16 +246,52 @@ void * MemoryManager<MemBlockPtrT, ThreadListT>::malloc(size_t sz, std::align_va
     return mem.ptr();
 }
 
+template <typename MemBlockPtrT, typename ThreadListT>
+void * MemoryManager<MemBlockPtrT, ThreadListT>::sampledMalloc(ThreadPool & tp, size_t sz)
+{
+    if ( ! _profiler.enabled()) {
+        tp.restartSampleCountDown(_profiler);
+        return nullptr;
+    }
+    // Neither the allocation itself nor any done while capturing the stack must be sampled.
+    tp.stopSampleCountDown();
+    void * ptr = malloc(sz);
+    if (ptr != nullptr) {
+        _profiler.record(ptr, sz);
+    }
+    tp.restartSampleCountDown(_profiler);
+    return ptr;
+}
+
+template <typename MemBlockPtrT, typename ThreadListT>
+void MemoryManager<MemBlockPtrT, ThreadListT>::dumpHeapProfileToFile()
+{
+    static std::atomic<int> sequence(0);
+    char fileName[1024];
+    snprintf(fileName, sizeof(fileName), "%s.%d.%d", _heapProfileFile, getpid(), sequence.fetch_add(1));
+    FILE * fp = fopen(fileName, "w");
+    if (fp != nullptr) {
+        dumpHeapProfile(fp);
+        fclose(fp);
+        fprintf(_G_logFile, "Heap profile written to %s\n", fileName);
+    } else {
+        fprintf(_G_logFile, "Failed writing heap profile to %s\n", fileName);
+    }
+}
+
 template <typename MemBlockPtrT, typename ThreadListT>
 void MemoryManager<MemBlockPtrT, ThreadListT>::freeSC(void *ptr, SizeClassT sc)
 {
+    if (__builtin_expect(_profiler.maybeSampled(ptr), false)) {
+        _profiler.release(ptr);
+    }
     if (MemBlockPtrT::verifySizeClass(sc)) {
         ThreadPool & tp = _threadList.getCurrent();
         MemBlockPtrT mem(ptr);
         mem.readjustAlignment(_segment);
         if (mem.validAlloc()) {
             mem.free();
-            tp.free(mem, sc);
+            tp.free(mem, sc, (_segment.numaNodes() > 1) ? _segment.numaNode(ptr) : 0);
         } else if (mem.validFree()) {
             fprintf(stderr, "Already deleted %p(%ld).\n", mem.ptr(), mem.size());
             crash();
@@ -243,7 +315,7 @@ void * MemoryManager<MemBlockPtrT, ThreadListT>::realloc(void *oldPtr, size_t sz
         // `realloc` shall preserve buffer contents up to and including the _minimum_ of the old and new sizes.
         const size_t preserve_mem_sz = std::min(sz, MemBlockPtrT::unAdjustSize(oldBlockSize));
         memcpy(ptr, oldPtr, preserve_mem_sz);
-        _mmapPool.unmap(MemBlockPtrT(oldPtr).rawPtr());
+        freeMMapped(oldPtr);
         return ptr;
     }
 
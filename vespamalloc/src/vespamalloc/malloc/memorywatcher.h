@@ -8,6 +8,8 @@
 #include <ctype.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
 #include <vespamalloc/malloc/malloc.h>
 #include <vespamalloc/util/callstack.h>
 
@@ -20,9 +22,12 @@ class MemoryWatcher : public MemoryManager<T, S>
 public:
     MemoryWatcher(int infoAtEnd, size_t prAllocAtStart) __attribute__((noinline));
     virtual ~MemoryWatcher() __attribute__((noinline));
+    /// Starts the thread writing the heap profile on heapprofile_signal, if that is configured.
+    void startHeapProfileWriter() __attribute__((noinline));
 private:
     void installMonitor();
     int     getDumpSignal() const { return _params[Params::dumpsignal].valueAsLong(); }
+    int     getHeapProfileSignal() const { return _params[Params::heapprofile_signal].valueAsLong(); }
     static int getReconfigSignal() { return SIGHUP; }
     bool activateLogFile(const char *logfile);
     void activateOptions();
@@ -32,6 +37,7 @@ private:
     static MemoryWatcher<T, S> * _manager;
     static void ssignalHandler(int signum, siginfo_t *info, void * arg);
     static MemoryWatcher<T, S> *manager() { return _manager; }
+    static void * heapProfileWriter(void * arg);
     bool signal(int signum) __attribute__ ((noinline));
     class NameValuePair {
     public:
@@ -67,6 +73,10 @@ private:
             bigblocklimit,
             fillvalue,
             dumpsignal,
+            heapprofile_sampleinterval,
+            heapprofile_maxsamples,
+            heapprofile_signal,
+            heapprofile_file,
             numberofentries  // Must be the last one
         };
         Params() __attribute__ ((noinline));
@@ -109,6 +119,7 @@ private:
 
     Params _params;
     struct sigaction _oldSig;
+    sem_t  _heapProfileRequest;
 };
 
 template <typename T, typename S>
@@ -126,6 +137,10 @@ MemoryWatcher<T, S>::Params::Params()
     _params[          bigblocklimit] = NameValuePair("bigblocklimit", "0x80000000"); // 8M
     _params[              fillvalue] = NameValuePair("fillvalue", "0xa8"); // Means NO fill.
     _params[             dumpsignal] = NameValuePair("dumpsignal", "27"); // SIGPROF
+    _params[heapprofile_sampleinterval] = NameValuePair("heapprofile_sampleinterval", "0"); // 0 means off, 0x80000 is a good value.
+    _params[ heapprofile_maxsamples] = NameValuePair("heapprofile_maxsamples", "0x10000");
+    _params[     heapprofile_signal] = NameValuePair("heapprofile_signal", "0"); // 0 means no signal. SIGUSR2 is 12.
+    _params[       heapprofile_file] = NameValuePair("heapprofile_file", "vespamalloc.heap"); // .<pid>.<seq> is appended
 }
 
 template <typename T, typename S>
@@ -160,6 +175,7 @@ MemoryWatcher<T, S>::MemoryWatcher(int infoAtEnd, size_t prAllocAtStart) :
     char tmp[16];
     sprintf(tmp, "%d", infoAtEnd);
     _params[Params::atend_loglevel].value(tmp);
+    sem_init(&_heapProfileRequest, 0, 0);
     installMonitor();
 }
 
@@ -170,6 +186,9 @@ void MemoryWatcher<T, S>::installMonitor()
 
     signal(getDumpSignal());
     signal(getReconfigSignal());
+    if (getHeapProfileSignal() > 0) {
+        signal(getHeapProfileSignal());
+    }
 }
 
 template <typename T, typename S>
@@ -204,7 +223,34 @@ void MemoryWatcher<T, S>::activateOptions()
     this->setParams(_params[Params::threadcachelimit].valueAsLong());
     _G_bigBlockLimit = _params[Params::bigblocklimit].valueAsLong();
     T::setFill(_params[Params::fillvalue].valueAsLong());
+    this->setupHeapProfile(_params[Params::heapprofile_sampleinterval].valueAsLong(),
+                           _params[Params::heapprofile_maxsamples].valueAsLong(),
+                           _params[Params::heapprofile_file].value());
+}
+
+template <typename T, typename S>
+void MemoryWatcher<T, S>::startHeapProfileWriter()
+{
+    if ((getHeapProfileSignal() > 0) && this->heapProfileEnabled()) {
+        pthread_t thread;
+        if (pthread_create(&thread, nullptr, heapProfileWriter, this) == 0) {
+            pthread_detach(thread);
+        } else {
+            fprintf(_logFile, "Failed starting heap profile writer, signal %d is ignored\n", getHeapProfileSignal());
+        }
+    }
+}
 
+template <typename T, typename S>
+void * MemoryWatcher<T, S>::heapProfileWriter(void * arg)
+{
+    MemoryWatcher<T, S> * watcher = static_cast<MemoryWatcher<T, S> *>(arg);
+    for (;;) {
+        if (sem_wait(&watcher->_heapProfileRequest) == 0) {
+            watcher->dumpHeapProfileToFile();
+        }
+    }
+    return nullptr;
 }
 
 namespace {
@@ -323,6 +369,11 @@ void MemoryWatcher<T, S>::signalHandler(int signum, siginfo_t * sig, void *  arg
     }
     if (signum == getDumpSignal()) {
         this->info(_logFile, _params[Params::sigprof_loglevel].valueAsLong());
+    } else if (signum == getHeapProfileSignal()) {
+        // Writing the profile takes locks and allocates, so that is left to the heap profile writer.
+        if (this->heapProfileEnabled()) {
+            sem_post(&_heapProfileRequest);
+        }
     } else if (signum == getReconfigSignal()) {
         getOptions();
         if (_params[Params::sigprof_loglevel].valueAsLong() > 1) {
@@ -14,7 +14,8 @@ public:
     static constexpr unsigned CONSTRUCTED = 0x192A3B4C;
     static constexpr unsigned DESTRUCTED = 0xd1d2d3d4;
     CreateAllocator() : _initialized(CONSTRUCTED) {
-        vespamalloc::createAllocator();
+        // Threads can not be started from the first malloc, but they can from here.
+        vespamalloc::createAllocator()->startHeapProfileWriter();
     }
     ~CreateAllocator() {
         assert(_initialized == CONSTRUCTED);
@@ -24,6 +24,11 @@ public:
     void setParams(size_t threadCacheLimit) {
         ThreadPool::setParams(threadCacheLimit);
     }
+    void resetSampleCountDowns() {
+        for (auto & thread : _threadVector) {
+            thread.resetSampleCountDown();
+        }
+    }
     bool quitThisThread();
     bool initThisThread();
     ThreadPool & getCurrent()  { return *_myPool; }
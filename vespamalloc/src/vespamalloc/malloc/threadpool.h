@@ -4,6 +4,7 @@
 #include "common.h"
 #include "allocchunk.h"
 #include "globalpool.h"
+#include "heapprofiler.h"
 #include "mmappool.h"
 #include <atomic>
 
@@ -28,7 +29,23 @@ public:
     }
     int mallopt(int param, int value);
     void malloc(size_t sz, MemBlockPtrT & mem);
-    void free(MemBlockPtrT mem, SizeClassT sc);
+    /**
+     * Memory handed out for another NUMA node than the one of this thread is
+     * collected separately and returned to the pool of its home node.
+     */
+    void free(MemBlockPtrT mem, SizeClassT sc, uint32_t numaNode);
+    /// Counts down the bytes allocated by this thread, returns true when the next allocation should be sampled.
+    bool countDownToSample(size_t sz) {
+        int64_t left = _bytesUntilSample.load(std::memory_order_relaxed) - int64_t(sz);
+        _bytesUntilSample.store(left, std::memory_order_relaxed);
+        return left < 0;
+    }
+    void restartSampleCountDown(const HeapProfiler & profiler) {
+        _bytesUntilSample.store(profiler.nextSampleCountDown(_sampleRandomState), std::memory_order_relaxed);
+    }
+    void stopSampleCountDown() { _bytesUntilSample.store(INT64_MAX, std::memory_order_relaxed); }
+    /// Makes the next allocation draw a new count down, e.g. after the sample interval has changed.
+    void resetSampleCountDown() { _bytesUntilSample.store(0, std::memory_order_relaxed); }
 
     void info(FILE * os, size_t level, const DataSegment & ds) const __attribute__((noinline));
     /**
@@ -43,6 +60,7 @@ public:
     bool isUsed() const;
     int osThreadId()       const { return _osThreadId; }
     uint32_t threadId()    const { return _threadId; }
+    uint32_t numaNode()    const { return _numaNode; }
     void quit() { _osThreadId = 0; } // Implicit memory barrier
     void init(int thrId);
     static void setParams(size_t threadCacheLimit);
@@ -69,15 +87,26 @@ private:
         ChunkSList *_allocFrom;
         ChunkSList *_freeTo;
     };
+    class RemoteFree {
+    public:
+        RemoteFree() : _freeTo(nullptr), _numaNode(0) { }
+        ChunkSList *_freeTo;
+        uint32_t    _numaNode;
+    };
     void mallocHelper(size_t exactSize, SizeClassT sc, AllocFree & af, MemBlockPtrT & mem) __attribute__ ((noinline));
+    void freeRemote(MemBlockPtrT mem, SizeClassT sc, uint32_t numaNode) __attribute__ ((noinline));
     static constexpr bool alwaysReuse(SizeClassT sc) { return sc > ALWAYS_REUSE_SC_LIMIT; }
 
     AllocPool   * _allocPool;
     MMapPool    * _mmapPool;
     size_t        _mmapLimit;
     AllocFree     _memList[NUM_SIZE_CLASSES];
+    RemoteFree    _remoteFree[NUM_SIZE_CLASSES];
     ThreadStatT   _stat[NUM_SIZE_CLASSES];
     uint32_t      _threadId;
+    uint32_t      _numaNode;
+    std::atomic<int64_t> _bytesUntilSample;
+    uint64_t      _sampleRandomState;
     std::atomic<ssize_t> _osThreadId;
 
     static constexpr SizeClassT ALWAYS_REUSE_SC_LIMIT = std::max(MemBlockPtrT::sizeClass(ALWAYS_REUSE_LIMIT),
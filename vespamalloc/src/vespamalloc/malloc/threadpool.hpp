@@ -71,7 +71,7 @@ mallocHelper(size_t exactSize,
         PARANOID_CHECK2( if (!mem.ptr()) { *(int *)0 = 0; } );
     } else {
         if ( ! alwaysReuse(sc) ) {
-            af._allocFrom = _allocPool->exchangeAlloc(sc, af._allocFrom);
+            af._allocFrom = _allocPool->exchangeAlloc(sc, af._allocFrom, _numaNode);
             _stat[sc].incExchangeAlloc();
             if (af._allocFrom) {
                 af._allocFrom->sub(mem);
@@ -86,7 +86,7 @@ mallocHelper(size_t exactSize,
                 mem.setExact(exactSize);
                 mem.free();
             } else {
-                af._allocFrom = _allocPool->exactAlloc(exactSize, sc, af._allocFrom);
+                af._allocFrom = _allocPool->exactAlloc(exactSize, sc, af._allocFrom, _numaNode);
                 _stat[sc].incExactAlloc();
                 if (af._allocFrom) {
                     af._allocFrom->sub(mem);
@@ -105,6 +105,9 @@ ThreadPoolT<MemBlockPtrT, ThreadStatT>::ThreadPoolT() :
     _mmapPool(nullptr),
     _mmapLimit(MMAP_LIMIT_MAX),
     _threadId(0),
+    _numaNode(0),
+    _bytesUntilSample(0),
+    _sampleRandomState(0),
     _osThreadId(0)
 {
 }
@@ -140,9 +143,44 @@ void ThreadPoolT<MemBlockPtrT, ThreadStatT>::malloc(size_t sz, MemBlockPtrT & me
 }
 
 template <typename MemBlockPtrT, typename ThreadStatT >
-void ThreadPoolT<MemBlockPtrT, ThreadStatT>::free(MemBlockPtrT mem, SizeClassT sc)
+void
+ThreadPoolT<MemBlockPtrT, ThreadStatT>::freeRemote(MemBlockPtrT mem, SizeClassT sc, uint32_t numaNode)
+{
+    if (alwaysReuse(sc)) {
+        // These are never pooled per node, so the block goes straight back to the data segment.
+        // It is re-tagged for whichever node gets it next.
+        AllocFree & af = _memList[sc];
+        af._freeTo->add(mem);
+        af._freeTo = _allocPool->returnMemory(sc, af._freeTo);
+        _stat[sc].incReturnFree();
+        _stat[sc].incFree();
+        return;
+    }
+    RemoteFree & rf = _remoteFree[sc];
+    if (rf._freeTo == nullptr) {
+        rf._freeTo = _allocPool->getFree(sc, 1);
+        ASSERT_STACKTRACE(rf._freeTo != nullptr);
+    } else if ((rf._numaNode != numaNode) && !rf._freeTo->empty()) {
+        rf._freeTo = _allocPool->exchangeFree(sc, rf._freeTo, rf._numaNode);
+        _stat[sc].incExchangeFree();
+    }
+    rf._numaNode = numaNode;
+    rf._freeTo->add(mem);
+    if (rf._freeTo->full() || (rf._freeTo->count()*MemBlockPtrT::classSize(sc) >= _threadCacheLimit)) {
+        rf._freeTo = _allocPool->exchangeFree(sc, rf._freeTo, numaNode);
+        _stat[sc].incExchangeFree();
+    }
+    _stat[sc].incFree();
+}
+
+template <typename MemBlockPtrT, typename ThreadStatT >
+void ThreadPoolT<MemBlockPtrT, ThreadStatT>::free(MemBlockPtrT mem, SizeClassT sc, uint32_t numaNode)
 {
     PARANOID_CHECK2(if (!mem.validFree()) { *(int *)1 = 1; } );
+    if (__builtin_expect(numaNode != _numaNode, false)) {
+        freeRemote(mem, sc, numaNode);
+        return;
+    }
     AllocFree & af = _memList[sc];
     const size_t cs(MemBlockPtrT::classSize(sc));
     if ((af._allocFrom->count()+1)*cs < _threadCacheLimit) {
@@ -151,19 +189,19 @@ void ThreadPoolT<MemBlockPtrT, ThreadStatT>::free(MemBlockPtrT mem, SizeClassT s
         } else {
             af._freeTo->add(mem);
             if (af._freeTo->full()) {
-                af._freeTo = _allocPool->exchangeFree(sc, af._freeTo);
+                af._freeTo = _allocPool->exchangeFree(sc, af._freeTo, _numaNode);
                 _stat[sc].incExchangeFree();
             }
         }
     } else if (cs < _threadCacheLimit) {
         af._freeTo->add(mem);
         if (af._freeTo->count()*cs > _threadCacheLimit) {
-            af._freeTo = _allocPool->exchangeFree(sc, af._freeTo);
+            af._freeTo = _allocPool->exchangeFree(sc, af._freeTo, _numaNode);
             _stat[sc].incExchangeFree();
         }
     } else if ( !alwaysReuse(sc) ) {
         af._freeTo->add(mem);
-        af._freeTo = _allocPool->exchangeFree(sc, af._freeTo);
+        af._freeTo = _allocPool->exchangeFree(sc, af._freeTo, _numaNode);
         _stat[sc].incExchangeFree();
     } else {
         af._freeTo->add(mem);
@@ -207,6 +245,9 @@ void ThreadPoolT<MemBlockPtrT, ThreadStatT>::init(int thrId)
     setThreadId(thrId);
     ASSERT_STACKTRACE(_osThreadId.load(std::memory_order_relaxed) == -1);
     _osThreadId = pthread_self();
+    _numaNode = _allocPool->numaNodeOfCurrentThread();
+    _sampleRandomState = (uint64_t(thrId) * 0x9E3779B97F4A7C15ul) | 1;
+    resetSampleCountDown();
     for (size_t i=0; (i < NELEMS(_memList)); i++) {
         _memList[i].init(*_allocPool, i);
     }
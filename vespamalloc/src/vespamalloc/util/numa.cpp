@@ -0,0 +1,67 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include "numa.h"
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+namespace vespamalloc::numa {
+
+uint32_t
+numNodes()
+{
+    uint32_t count(1);
+#ifdef __linux__
+    // Format is a range list, e.g. "0" or "0-1". The last number is the highest node id.
+    int fd = open("/sys/devices/system/node/possible", O_RDONLY);
+    if (fd >= 0) {
+        char buf[128];
+        ssize_t sz = read(fd, buf, sizeof(buf) - 1);
+        close(fd);
+        if (sz > 0) {
+            buf[sz] = '\0';
+            const char * last = buf;
+            for (const char * p = buf; *p; p++) {
+                if ((*p == '-') || (*p == ',')) {
+                    last = p + 1;
+                }
+            }
+            count = strtoul(last, nullptr, 10) + 1;
+        }
+    }
+#endif
+    return (count < MAX_NODES) ? count : MAX_NODES;
+}
+
+uint32_t
+currentNode()
+{
+#ifdef __linux__
+    unsigned cpu(0), node(0);
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return node;
+    }
+#endif
+    return 0;
+}
+
+bool
+preferNode(void * mem, size_t len, uint32_t node, bool moveExisting)
+{
+#ifdef __linux__
+    unsigned long nodeMask = 1ul << node;
+    unsigned flags = moveExisting ? MPOL_MF_MOVE : 0;
+    return syscall(SYS_mbind, mem, len, MPOL_PREFERRED, &nodeMask, sizeof(nodeMask) * 8, flags) == 0;
+#else
+    (void) mem;
+    (void) len;
+    (void) node;
+    (void) moveExisting;
+    return false;
+#endif
+}
+
+}
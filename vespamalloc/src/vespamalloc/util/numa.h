@@ -0,0 +1,24 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Minimal NUMA support for the allocator. Uses the system calls directly,
+ * as neither libnuma nor anything else that might allocate can be used here.
+ */
+namespace vespamalloc::numa {
+
+/// Max number of NUMA nodes with separate pools. Nodes beyond this are folded onto the lower ones.
+static constexpr uint32_t MAX_NODES = 8;
+
+/// Number of NUMA nodes on this host, capped at MAX_NODES. Returns 1 if not NUMA or unknown.
+uint32_t numNodes();
+/// The NUMA node of the cpu currently running this thread.
+uint32_t currentNode();
+/// Prefer to place pages in [mem, mem + len) on the given node when they are first touched.
+/// With moveExisting, pages already touched are migrated there as well.
+bool preferNode(void * mem, size_t len, uint32_t node, bool moveExisting = false);
+
+}